@@ -133,8 +133,8 @@ CommandResult FileClient::cmd_file(const std::vector<std::string>& args) {
         if (info.type == FileType::REGULAR_FILE) {
             // 尝试判断文件内容类型
             try {
-                std::string content = filesystem_->read_file_content(resolved_path, 1024);
-                if (is_text_file(content)) {
+                auto view = filesystem_->map_file_content(resolved_path, 0, 1024, AccessPattern::RANDOM);
+                if (is_text_file(view->data())) {
                     result << ", text file";
                 } else {
                     result << ", binary file";
@@ -239,7 +239,9 @@ CommandResult FileClient::cmd_cat(const std::vector<std::string>& args) {
         }
         
         // 限制最大读取大小为1MB，避免内存问题
-        std::string content = filesystem_->read_file_content(resolved_path, 1024 * 1024);
+        // 映射后直接检查内容，只在输出时复制一次
+        auto view = filesystem_->map_file_content(resolved_path, 0, 1024 * 1024);
+        std::string_view content = view->data();
         
         if (content.empty()) {
             return CommandResult(true, "File is empty");
@@ -250,7 +252,7 @@ CommandResult FileClient::cmd_cat(const std::vector<std::string>& args) {
             return CommandResult(false, filename + " is a binary file, cannot display");
         }
         
-        return CommandResult(true, content);
+        return CommandResult(true, std::string(content));
         
     } catch (const std::exception& e) {
         return CommandResult(false, "Error: " + std::string(e.what()));
@@ -383,7 +385,7 @@ std::string FileClient::get_file_mime_type(const std::string& filename) {
     return "";
 }
 
-bool FileClient::is_text_file(const std::string& content) {
+bool FileClient::is_text_file(std::string_view content) {
     if (content.empty()) {
         return true;
     }
@@ -3,6 +3,7 @@
 #include "filesystem_interface.h"
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace file_client {
@@ -48,7 +49,7 @@ private:
     std::vector<std::string> parse_command(const std::string& command_line);
     void print_help();
     std::string get_file_mime_type(const std::string& filename);
-    bool is_text_file(const std::string& content);
+    bool is_text_file(std::string_view content);
 };
 
 } // namespace file_client
@@ -79,11 +79,20 @@ std::string FileSystemInterface::get_file_type_string(FileType type) {
     }
 }
 
+std::unique_ptr<FileView> FileSystemInterface::map_file_content(const std::string& path, size_t offset,
+                                                               size_t length, AccessPattern) {
+    if (length == 0) {
+        size_t size = get_file_size(path);
+        length = size > offset ? size - offset : 0;
+    }
+    return std::make_unique<OwnedFileView>(read_file_content_at_offset(path, offset, length));
+}
+
 // 工厂方法实现
-std::unique_ptr<FileSystemInterface> FileSystemFactory::create(Type type) {
+std::unique_ptr<FileSystemInterface> FileSystemFactory::create(Type type, const std::string& root_path) {
     switch (type) {
         case Type::LINUX:
-            return std::make_unique<LinuxFileSystem>();
+            return std::make_unique<LinuxFileSystem>(root_path);
         case Type::SPDB_SDK:
             // 暂时返回Linux实现，以后可以添加SPDB_SDK实现
             throw std::runtime_error("SPDB_SDK filesystem not implemented yet");
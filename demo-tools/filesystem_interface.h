@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <sys/stat.h>
@@ -31,6 +32,36 @@ struct FileInfo {
     std::string permissions_str;
 };
 
+// 文件内容的只读视图，视图对象存活期间 data() 一直有效
+class FileView {
+public:
+    explicit FileView(std::string_view data = {}) : data_(data) {}
+    virtual ~FileView() = default;
+
+    FileView(const FileView&) = delete;
+    FileView& operator=(const FileView&) = delete;
+
+    std::string_view data() const { return data_; }
+
+protected:
+    std::string_view data_;
+};
+
+// 持有一份内容副本的视图，用于无法映射的文件
+class OwnedFileView : public FileView {
+public:
+    explicit OwnedFileView(std::string content) : content_(std::move(content)) { data_ = content_; }
+
+private:
+    std::string content_;
+};
+
+// 视图的访问模式，映射实现据此给内核预读提示
+enum class AccessPattern {
+    SEQUENTIAL,
+    RANDOM
+};
+
 // 抽象文件系统接口
 class FileSystemInterface {
 public:
@@ -49,6 +80,12 @@ public:
     
     // 文件内容读取
     virtual std::string read_file_content(const std::string& path, size_t max_size = 0) = 0;
+    // 读取 [offset, offset + length) 范围，文件末尾处返回的内容可能更短
+    virtual std::string read_file_content_at_offset(const std::string& path, size_t offset, size_t length) = 0;
+    // 以视图读取 [offset, offset + length)，length 为 0 表示读到文件末尾
+    // 默认实现复制一份内容，本地文件系统用 mmap 实现零拷贝
+    virtual std::unique_ptr<FileView> map_file_content(const std::string& path, size_t offset = 0, size_t length = 0,
+                                                       AccessPattern pattern = AccessPattern::SEQUENTIAL);
     
     // 路径处理
     virtual std::string resolve_path(const std::string& path) const = 0;
@@ -70,7 +107,7 @@ public:
         SPDB_SDK
     };
     
-    static std::unique_ptr<FileSystemInterface> create(Type type);
+    static std::unique_ptr<FileSystemInterface> create(Type type, const std::string& root_path = "test");
 };
 
 } // namespace file_client
@@ -4,14 +4,33 @@
 #include <sstream>
 #include <iomanip>
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <cstring>
+#include <cerrno>
 #include <ctime>
 #include <algorithm>
 
 namespace file_client {
 
+namespace {
+
+// mmap 映射的视图，析构时解除映射
+class MappedFileView : public FileView {
+public:
+    MappedFileView(void* base, size_t mapped_length, std::string_view data)
+        : FileView(data), base_(base), mapped_length_(mapped_length) {}
+    ~MappedFileView() override { munmap(base_, mapped_length_); }
+
+private:
+    void* base_;
+    size_t mapped_length_;
+};
+
+} // namespace
+
 LinuxFileSystem::LinuxFileSystem(const std::string& root_path) 
     : current_path_("/") {
     // 转换为绝对路径
@@ -157,6 +176,140 @@ std::string LinuxFileSystem::read_file_content(const std::string& path, size_t m
     }
 }
 
+std::string LinuxFileSystem::read_file_content_at_offset(const std::string& path, size_t offset, size_t length) {
+    std::string full_path = get_full_path(path);
+    int fd = open(full_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+
+    std::string content(length, '\0');
+    size_t filled = 0;
+    while (filled < length) {
+        ssize_t n = pread(fd, &content[filled], length - filled, offset + filled);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            close(fd);
+            throw std::runtime_error("Cannot read file: " + path);
+        }
+        if (n == 0) {
+            break; // 文件末尾
+        }
+        filled += n;
+    }
+    close(fd);
+    content.resize(filled);
+    return content;
+}
+
+std::unique_ptr<FileView> LinuxFileSystem::map_file_content(const std::string& path, size_t offset, size_t length,
+                                                           AccessPattern pattern) {
+    std::string full_path = get_full_path(path);
+    int fd = open(full_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw std::runtime_error("Cannot get file info: " + path);
+    }
+
+    // 特殊文件的大小不可信，逐块读到末尾
+    if (!S_ISREG(st.st_mode)) {
+        std::string content;
+        try {
+            content = pread_content(fd, path, offset, length);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+        return std::make_unique<OwnedFileView>(std::move(content));
+    }
+
+    size_t file_size = st.st_size;
+    if (offset >= file_size) {
+        close(fd);
+        return std::make_unique<FileView>();
+    }
+    size_t view_length = length == 0 ? file_size - offset : std::min(length, file_size - offset);
+
+    // mmap 的偏移必须按页对齐，视图从页内偏移处开始
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t map_offset = offset / page_size * page_size;
+    size_t map_length = view_length + (offset - map_offset);
+    void* base = mmap(nullptr, map_length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(map_offset));
+    if (base == MAP_FAILED) {
+        std::string content;
+        try {
+            content = pread_content(fd, path, offset, view_length);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+        return std::make_unique<OwnedFileView>(std::move(content));
+    }
+    // 映射建立后描述符即可关闭
+    close(fd);
+
+    madvise(base, map_length, pattern == AccessPattern::SEQUENTIAL ? MADV_SEQUENTIAL : MADV_RANDOM);
+    return std::make_unique<MappedFileView>(
+        base, map_length, std::string_view(static_cast<const char*>(base) + (offset - map_offset), view_length));
+}
+
+std::string LinuxFileSystem::pread_content(int fd, const std::string& path, size_t offset, size_t length) const {
+    // length 为 0 时读到 EOF
+    static const size_t READ_BLOCK = 64 * 1024;
+    std::string content;
+    size_t filled = 0;
+    bool sequential = false;
+    while (length == 0 || filled < length) {
+        size_t want = length == 0 ? READ_BLOCK : length - filled;
+        content.resize(filled + want);
+        ssize_t n = sequential ? read(fd, &content[filled], want) : pread(fd, &content[filled], want, offset + filled);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && errno == ESPIPE && !sequential) {
+            // 管道等不支持定位读取，先读出并丢弃 offset 个字节，之后顺序读取
+            sequential = true;
+            char discard[4096];
+            size_t skipped = 0;
+            while (skipped < offset) {
+                ssize_t m = read(fd, discard, std::min(sizeof(discard), offset - skipped));
+                if (m < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (m < 0) {
+                    throw std::runtime_error("Cannot read file: " + path);
+                }
+                if (m == 0) {
+                    break;
+                }
+                skipped += m;
+            }
+            if (skipped < offset) {
+                // offset 超出了流的长度
+                break;
+            }
+            continue;
+        }
+        if (n < 0) {
+            throw std::runtime_error("Cannot read file: " + path);
+        }
+        if (n == 0) {
+            break;
+        }
+        filled += n;
+    }
+    content.resize(filled);
+    return content;
+}
+
 std::string LinuxFileSystem::resolve_path(const std::string& path) const {
     if (path.empty()) {
         return current_path_;
@@ -23,6 +23,10 @@ public:
     
     // 文件内容读取
     std::string read_file_content(const std::string& path, size_t max_size = 0) override;
+    std::string read_file_content_at_offset(const std::string& path, size_t offset, size_t length) override;
+    // 普通文件用 mmap 映射，特殊文件（管道、字符设备等）退回到 pread
+    std::unique_ptr<FileView> map_file_content(const std::string& path, size_t offset = 0, size_t length = 0,
+                                               AccessPattern pattern = AccessPattern::SEQUENTIAL) override;
     
     // 路径处理
     std::string resolve_path(const std::string& path) const override;
@@ -42,6 +46,7 @@ private:
     // 辅助方法
     std::string get_full_path(const std::string& path) const;
     FileType mode_to_file_type(mode_t mode) const;
+    std::string pread_content(int fd, const std::string& path, size_t offset, size_t length) const;
     size_t calculate_directory_size_recursive(const std::string& path) const;
     std::string normalize_path(const std::string& path) const;
     bool is_safe_path(const std::string& path) const;
@@ -0,0 +1,86 @@
+/**
+ * @file aligned_buffer.h
+ * @brief Aligned I/O buffer helper
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Owns a heap buffer whose start address and capacity are aligned to the
+ * storage I/O alignment, so it can be handed directly to pread.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace file_client
+{
+
+    /**
+     * @class AlignedBuffer
+     * @brief Move-only RAII wrapper around an aligned allocation
+     */
+    class AlignedBuffer
+    {
+    public:
+        static constexpr size_t DEFAULT_ALIGNMENT = 4096; ///< Storage block alignment
+
+        AlignedBuffer() = default;
+
+        /**
+         * @brief Allocate an aligned buffer
+         * @param size Requested capacity, rounded up to a multiple of alignment
+         * @param alignment Address alignment, must be a power of two
+         * @throw std::bad_alloc if allocation fails
+         */
+        explicit AlignedBuffer(size_t size, size_t alignment = DEFAULT_ALIGNMENT)
+            : size_(round_up(size, alignment))
+        {
+            void *ptr = nullptr;
+            if (posix_memalign(&ptr, alignment, size_ == 0 ? alignment : size_) != 0)
+            {
+                throw std::bad_alloc();
+            }
+            data_ = static_cast<char *>(ptr);
+        }
+
+        ~AlignedBuffer() { free(data_); }
+
+        AlignedBuffer(const AlignedBuffer &) = delete;
+        AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+
+        AlignedBuffer(AlignedBuffer &&other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+        AlignedBuffer &operator=(AlignedBuffer &&other) noexcept
+        {
+            if (this != &other)
+            {
+                free(data_);
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        char *data() { return data_; }
+        const char *data() const { return data_; }
+        size_t size() const { return size_; }
+
+        /**
+         * @brief Round value up to a multiple of alignment
+         */
+        static size_t round_up(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+    private:
+        char *data_ = nullptr; ///< Aligned storage
+        size_t size_ = 0;      ///< Capacity in bytes
+    };
+
+} // namespace file_client
@@ -0,0 +1,502 @@
+/**
+ * @file bench.cpp
+ * @brief ops_bench - SDK file system backend benchmark
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Drives SPDB_SDKFileSystem through stat, open, sequential/random
+ * pread and list_directory and prints throughput and latency percentiles,
+ * one JSON object (or CSV row) per measurement.
+ *
+ * Usage:
+ *   ops_bench [--backend spdb_sdk] [--root DIR] [--ops stat,open,seqread,randread,list]
+ *             [--threads 1,4,16] [--depth 1,8] [--request-size 4096,16384]
+ *             [--entries 1000,10000,100000] [--file-size BYTES] [--seconds S]
+ *             [--cache on|off] [--format json|csv]
+ *
+ * Comma separated values are swept. The fixture lives in <root>/ops_bench and
+ * is written through the SDK backend under test on first use. The interface is
+ * synchronous, so a queue depth of D is emulated by D callers per thread
+ * (threads * depth requests in flight). With --cache off (the default) the SDK
+ * backend's stat and metadata caches are disabled and its descriptor pool is
+ * shrunk to one entry, so every call reaches the SDK.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <unistd.h>
+#include <vector>
+#include <glog/logging.h>
+
+#include "aligned_buffer.h"
+#include "fd_output_buffer.h"
+#include "spdb_sdk_filesystem.h"
+
+namespace
+{
+
+    using file_client::AlignedBuffer;
+    using file_client::SPDB_SDKFileSystem;
+    using Clock = std::chrono::steady_clock;
+
+    const char *FIXTURE_DIR = "/ops_bench";
+    constexpr size_t STAT_FILES = 1000;             ///< Files cycled through by stat and open
+    constexpr size_t FIXTURE_BLOCK = 1024 * 1024;   ///< Write size used to lay out the data file
+
+    struct Options
+    {
+        std::string backend_name = "spdb_sdk";
+        std::string root = "test";
+        std::vector<std::string> ops = {"stat", "open", "seqread", "randread", "list"};
+        std::vector<size_t> threads = {1, 4, 16};
+        std::vector<size_t> depths = {1};
+        std::vector<size_t> request_sizes = {16384};
+        std::vector<size_t> entries = {1000, 10000, 100000};
+        size_t file_size = 256ULL << 20;
+        double seconds = 3.0;
+        bool cache = false;
+        bool csv = false;
+    };
+
+    struct Result
+    {
+        std::string op;
+        size_t threads = 0;
+        size_t depth = 0;
+        size_t request_size = 0;
+        size_t entries = 0;
+        uint64_t ops = 0;
+        uint64_t bytes = 0;
+        uint64_t errors = 0;
+        double seconds = 0;
+        std::vector<uint64_t> latencies_ns;
+    };
+
+    std::vector<std::string> split_list(const std::string &value)
+    {
+        std::vector<std::string> items;
+        std::stringstream ss(value);
+        std::string item;
+        while (std::getline(ss, item, ','))
+        {
+            if (!item.empty())
+            {
+                items.push_back(item);
+            }
+        }
+        return items;
+    }
+
+    std::vector<size_t> split_sizes(const std::string &value)
+    {
+        std::vector<size_t> sizes;
+        for (const auto &item : split_list(value))
+        {
+            sizes.push_back(std::stoull(item));
+        }
+        if (sizes.empty())
+        {
+            throw std::runtime_error("empty list: " + value);
+        }
+        return sizes;
+    }
+
+    Options parse_options(int argc, char *argv[])
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("missing value for " + arg);
+            }
+            std::string value = argv[++i];
+            if (arg == "--backend")
+            {
+                // The SDK backend is the only one built in ops-tools
+                if (value != "spdb_sdk")
+                {
+                    throw std::runtime_error("unknown backend: " + value);
+                }
+                options.backend_name = value;
+            }
+            else if (arg == "--root")
+            {
+                options.root = value;
+            }
+            else if (arg == "--ops")
+            {
+                options.ops = split_list(value);
+            }
+            else if (arg == "--threads")
+            {
+                options.threads = split_sizes(value);
+            }
+            else if (arg == "--depth")
+            {
+                options.depths = split_sizes(value);
+            }
+            else if (arg == "--request-size")
+            {
+                options.request_sizes = split_sizes(value);
+            }
+            else if (arg == "--entries")
+            {
+                options.entries = split_sizes(value);
+            }
+            else if (arg == "--file-size")
+            {
+                options.file_size = std::stoull(value);
+            }
+            else if (arg == "--seconds")
+            {
+                options.seconds = std::stod(value);
+            }
+            else if (arg == "--cache")
+            {
+                options.cache = value == "on";
+            }
+            else if (arg == "--format")
+            {
+                options.csv = value == "csv";
+            }
+            else
+            {
+                throw std::runtime_error("unknown option: " + arg);
+            }
+        }
+        return options;
+    }
+
+    /**
+     * @brief Make sure dir holds one-byte files f0..f<count-1>, existing files are reused
+     * @note Not empty, so the open workload's 1-byte read succeeds
+     */
+    void ensure_files(SPDB_SDKFileSystem &fs, const std::string &dir, size_t count)
+    {
+        fs.create_directory(dir);
+        std::unordered_set<std::string> present;
+        for (const auto &info : fs.list_directory(dir))
+        {
+            present.insert(info.name);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string name = "f" + std::to_string(i);
+            if (!present.count(name))
+            {
+                fs.write_file(dir + "/" + name, 0, "x", 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Make sure path holds at least size bytes of random data
+     * @note Real data rather than holes, so reads cannot take a zero-page fast path
+     */
+    void ensure_data_file(SPDB_SDKFileSystem &fs, const std::string &path, size_t size)
+    {
+        if (fs.exists(path) && static_cast<size_t>(fs.get_file_size(path)) >= size)
+        {
+            return;
+        }
+        AlignedBuffer block(FIXTURE_BLOCK);
+        std::mt19937_64 rng(42);
+        for (size_t written = 0; written < size; written += block.size())
+        {
+            for (size_t i = 0; i < block.size(); i += sizeof(uint64_t))
+            {
+                uint64_t word = rng();
+                std::copy(reinterpret_cast<char *>(&word), reinterpret_cast<char *>(&word) + sizeof(word),
+                          block.data() + i);
+            }
+            fs.write_file(path, written, block.data(), std::min(block.size(), size - written));
+        }
+    }
+
+    /**
+     * @brief Turn off the SDK backend's caches so every call is a remote round trip
+     */
+    void disable_caches(SPDB_SDKFileSystem &fs)
+    {
+        fs.stat_cache().set_ttl(std::chrono::milliseconds(0));
+        fs.metadata_cache().set_ttl(std::chrono::milliseconds(0));
+        fs.fd_pool().set_capacity(1);
+    }
+
+    uint64_t percentile(const std::vector<uint64_t> &sorted, double p)
+    {
+        if (sorted.empty())
+        {
+            return 0;
+        }
+        size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    /**
+     * @brief Run op(caller, iteration) on every caller until the deadline
+     * @param op Returns the number of bytes read, throws on failure
+     */
+    template <typename Op>
+    Result run_workload(const std::string &name, size_t callers, double seconds, Op op)
+    {
+        struct Caller
+        {
+            std::vector<uint64_t> latencies;
+            uint64_t bytes = 0;
+            uint64_t errors = 0;
+        };
+        std::vector<Caller> state(callers);
+        std::atomic<bool> go{false};
+        Clock::time_point deadline;
+
+        std::vector<std::thread> workers;
+        workers.reserve(callers);
+        for (size_t c = 0; c < callers; ++c)
+        {
+            workers.emplace_back([&, c]
+            {
+                Caller &me = state[c];
+                me.latencies.reserve(1 << 16);
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                for (uint64_t iteration = 0; Clock::now() < deadline; ++iteration)
+                {
+                    auto start = Clock::now();
+                    try
+                    {
+                        me.bytes += op(c, iteration);
+                    }
+                    catch (const std::exception &)
+                    {
+                        me.errors++;
+                        continue;
+                    }
+                    me.latencies.push_back(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+                }
+            });
+        }
+
+        auto begin = Clock::now();
+        deadline = begin + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        go.store(true, std::memory_order_release);
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+
+        Result result;
+        result.op = name;
+        result.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+        for (auto &caller : state)
+        {
+            result.bytes += caller.bytes;
+            result.errors += caller.errors;
+            result.latencies_ns.insert(result.latencies_ns.end(), caller.latencies.begin(), caller.latencies.end());
+        }
+        result.ops = result.latencies_ns.size();
+        std::sort(result.latencies_ns.begin(), result.latencies_ns.end());
+        return result;
+    }
+
+    void print_result(std::ostream &out, const Options &options, const Result &r)
+    {
+        double ops_per_sec = r.seconds > 0 ? r.ops / r.seconds : 0;
+        double mb_per_sec = r.seconds > 0 ? r.bytes / r.seconds / (1 << 20) : 0;
+        double p50 = percentile(r.latencies_ns, 0.50) / 1000.0;
+        double p99 = percentile(r.latencies_ns, 0.99) / 1000.0;
+        double p999 = percentile(r.latencies_ns, 0.999) / 1000.0;
+
+        char line[512];
+        if (options.csv)
+        {
+            snprintf(line, sizeof(line), "%s,%s,%zu,%zu,%zu,%zu,%s,%llu,%llu,%.3f,%.1f,%.2f,%.1f,%.1f,%.1f",
+                     options.backend_name.c_str(), r.op.c_str(), r.threads, r.depth, r.request_size, r.entries,
+                     options.cache ? "on" : "off", static_cast<unsigned long long>(r.ops),
+                     static_cast<unsigned long long>(r.errors), r.seconds, ops_per_sec, mb_per_sec, p50, p99, p999);
+        }
+        else
+        {
+            snprintf(line, sizeof(line),
+                     "{\"backend\":\"%s\",\"op\":\"%s\",\"threads\":%zu,\"depth\":%zu,\"request_size\":%zu,"
+                     "\"entries\":%zu,\"cache\":\"%s\",\"ops\":%llu,\"errors\":%llu,\"seconds\":%.3f,"
+                     "\"ops_per_sec\":%.1f,\"mb_per_sec\":%.2f,\"p50_us\":%.1f,\"p99_us\":%.1f,\"p999_us\":%.1f}",
+                     options.backend_name.c_str(), r.op.c_str(), r.threads, r.depth, r.request_size, r.entries,
+                     options.cache ? "on" : "off", static_cast<unsigned long long>(r.ops),
+                     static_cast<unsigned long long>(r.errors), r.seconds, ops_per_sec, mb_per_sec, p50, p99, p999);
+        }
+        out << line << std::endl;
+    }
+
+    void run(std::ostream &out, const Options &options)
+    {
+        auto fs = std::make_unique<SPDB_SDKFileSystem>(options.root);
+        if (!options.cache)
+        {
+            disable_caches(*fs);
+        }
+
+        const std::string base = FIXTURE_DIR;
+        const std::string data_file = base + "/data.bin";
+        fs->create_directory(base);
+
+        if (options.csv)
+        {
+            out << "backend,op,threads,depth,request_size,entries,cache,ops,errors,seconds,"
+                   "ops_per_sec,mb_per_sec,p50_us,p99_us,p999_us" << std::endl;
+        }
+
+        for (const auto &op : options.ops)
+        {
+            bool is_read = op == "seqread" || op == "randread";
+            if (op == "stat" || op == "open")
+            {
+                ensure_files(*fs, base + "/stat", STAT_FILES);
+            }
+            else if (is_read)
+            {
+                ensure_data_file(*fs, data_file, options.file_size);
+            }
+            else if (op != "list")
+            {
+                throw std::runtime_error("unknown op: " + op);
+            }
+
+            // list sweeps directory sizes, reads sweep request sizes
+            std::vector<size_t> sizes = op == "list" ? options.entries
+                                      : is_read      ? options.request_sizes
+                                                     : std::vector<size_t>{0};
+            for (size_t size : sizes)
+            {
+                if (op == "list")
+                {
+                    ensure_files(*fs, base + "/list_" + std::to_string(size), size);
+                }
+                for (size_t threads : options.threads)
+                {
+                    for (size_t depth : options.depths)
+                    {
+                        size_t callers = std::max<size_t>(1, threads * depth);
+                        Result result;
+                        if (op == "stat")
+                        {
+                            result = run_workload(op, callers, options.seconds, [&](size_t c, uint64_t i)
+                            {
+                                fs->get_file_info(base + "/stat/f" + std::to_string((c * 7919 + i) % STAT_FILES));
+                                return uint64_t(0);
+                            });
+                        }
+                        else if (op == "open")
+                        {
+                            // The interface has no bare open, a 1-byte read measures open + close
+                            result = run_workload(op, callers, options.seconds, [&](size_t c, uint64_t i)
+                            {
+                                fs->read_file_content_at_offset(
+                                    base + "/stat/f" + std::to_string((c * 7919 + i) % STAT_FILES), 0, 1);
+                                return uint64_t(0);
+                            });
+                        }
+                        else if (op == "seqread")
+                        {
+                            // Every caller reads its own slice front to back
+                            size_t blocks = std::max<size_t>(1, options.file_size / size);
+                            size_t slice = std::max<size_t>(1, blocks / callers);
+                            result = run_workload(op, callers, options.seconds, [&](size_t c, uint64_t i)
+                            {
+                                size_t block = (c * slice + i % slice) % blocks;
+                                return uint64_t(fs->read_file_content_at_offset(data_file, block * size, size).size());
+                            });
+                        }
+                        else if (op == "randread")
+                        {
+                            size_t blocks = std::max<size_t>(1, options.file_size / size);
+                            std::vector<std::mt19937_64> rngs;
+                            for (size_t c = 0; c < callers; ++c)
+                            {
+                                rngs.emplace_back(c + 1);
+                            }
+                            result = run_workload(op, callers, options.seconds, [&](size_t c, uint64_t)
+                            {
+                                size_t block = rngs[c]() % blocks;
+                                return uint64_t(fs->read_file_content_at_offset(data_file, block * size, size).size());
+                            });
+                        }
+                        else
+                        {
+                            std::string dir = base + "/list_" + std::to_string(size);
+                            result = run_workload(op, callers, options.seconds, [&](size_t, uint64_t)
+                            {
+                                if (fs->list_directory(dir).size() < size)
+                                {
+                                    throw std::runtime_error("short listing");
+                                }
+                                return uint64_t(0);
+                            });
+                        }
+                        result.threads = threads;
+                        result.depth = depth;
+                        result.request_size = is_read ? size : 0;
+                        result.entries = op == "list" ? size : 0;
+                        print_result(out, options, result);
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace
+
+/**
+ * @brief Benchmark entry point
+ * @return int 0 on success, 1 if the options are invalid or the fixture cannot be created
+ * @note Results go to the original stdout, the SDK's own output is silenced like in ops_tools
+ */
+int main(int argc, char *argv[])
+{
+    int stdout_fd = dup(STDOUT_FILENO);
+
+    FILE *devnull = fopen("/dev/null", "w");
+    dup2(fileno(devnull), fileno(stdout));
+
+    FLAGS_log_dir = "/dev/null";
+    FLAGS_logtostderr = false;
+    FLAGS_alsologtostderr = false;
+    FLAGS_minloglevel = google::GLOG_WARNING;
+
+    google::InitGoogleLogging(argv[0]);
+
+    try
+    {
+        Options options = parse_options(argc, argv);
+        file_client::FdOutputBuffer buffer(stdout_fd);
+        std::ostream out(&buffer);
+        run(out, options);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << "Usage: " << (argc > 0 ? argv[0] : "ops_bench")
+                  << " [--backend spdb_sdk] [--root DIR] [--ops stat,open,seqread,randread,list]"
+                  << " [--threads N,..] [--depth N,..] [--request-size N,..] [--entries N,..]"
+                  << " [--file-size BYTES] [--seconds S] [--cache on|off] [--format json|csv]" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file block_prefetcher.cpp
+ * @brief Background block prefetcher implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "block_prefetcher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace file_client
+{
+
+    BlockPrefetcher::BlockPrefetcher(FileSystemInterface &fs, std::string path, size_t file_size,
+                                     size_t block_size, size_t slots)
+        : fs_(fs), path_(std::move(path)), file_size_(file_size),
+          block_size_(AlignedBuffer::round_up(std::max<size_t>(block_size, 1), AlignedBuffer::DEFAULT_ALIGNMENT)),
+          block_count_((file_size + block_size_ - 1) / block_size_),
+          slots_(std::max<size_t>(slots, 3))
+    {
+        for (auto &slot : slots_)
+        {
+            slot.buffer = AlignedBuffer(block_size_);
+        }
+        thread_ = std::thread([this]
+                              { prefetch_loop(); });
+    }
+
+    BlockPrefetcher::~BlockPrefetcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wanted_cv_.notify_all();
+        thread_.join();
+    }
+
+    size_t BlockPrefetcher::find_slot(size_t block) const
+    {
+        for (size_t i = 0; i < slots_.size(); ++i)
+        {
+            if (slots_[i].block == block && slots_[i].state != SlotState::EMPTY)
+            {
+                return i;
+            }
+        }
+        return NO_BLOCK;
+    }
+
+    size_t BlockPrefetcher::pick_victim() const
+    {
+        size_t victim = NO_BLOCK;
+        for (size_t i = 0; i < slots_.size(); ++i)
+        {
+            const Slot &slot = slots_[i];
+            if (slot.state == SlotState::EMPTY)
+            {
+                return i;
+            }
+            if (slot.state == SlotState::READY && (victim == NO_BLOCK || slot.last_use < slots_[victim].last_use))
+            {
+                victim = i;
+            }
+        }
+        return victim;
+    }
+
+    void BlockPrefetcher::load(size_t slot_index, size_t block, std::unique_lock<std::mutex> &lock)
+    {
+        Slot &slot = slots_[slot_index];
+        slot.block = block;
+        slot.state = SlotState::LOADING;
+        slot.last_use = ++clock_;
+        char *dest = slot.buffer.data();
+
+        // The slot is invisible to readers while LOADING, so it is filled without the lock
+        lock.unlock();
+        size_t offset = block * block_size_;
+        size_t length = std::min(block_size_, file_size_ - offset);
+        size_t filled = 0;
+        std::exception_ptr error;
+        try
+        {
+            filled = fs_.read_file_chunks(path_, offset, length,
+                                          [&](const char *data, size_t size, size_t chunk_offset)
+                                          {
+                                              std::memcpy(dest + (chunk_offset - offset), data, size);
+                                              return true;
+                                          },
+                                          block_size_);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        slot.length = filled;
+        slot.state = error ? SlotState::EMPTY : SlotState::READY;
+        if (error)
+        {
+            slot.block = NO_BLOCK;
+        }
+        loaded_cv_.notify_all();
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    size_t BlockPrefetcher::read(size_t offset, size_t length, char *out)
+    {
+        if (offset >= file_size_)
+        {
+            return 0;
+        }
+        length = std::min(length, file_size_ - offset);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        size_t copied = 0;
+        size_t last_block = offset / block_size_;
+        while (copied < length)
+        {
+            size_t pos = offset + copied;
+            size_t block = pos / block_size_;
+            last_block = block;
+
+            size_t index = find_slot(block);
+            if (index != NO_BLOCK && slots_[index].state == SlotState::READY)
+            {
+                counters_.hits++;
+            }
+            else
+            {
+                counters_.misses++;
+                while (index != NO_BLOCK && slots_[index].state == SlotState::LOADING)
+                {
+                    loaded_cv_.wait(lock);
+                    index = find_slot(block);
+                }
+                if (index == NO_BLOCK)
+                {
+                    while ((index = pick_victim()) == NO_BLOCK)
+                    {
+                        loaded_cv_.wait(lock); // Every slot is being filled
+                    }
+                    load(index, block, lock);
+                }
+            }
+
+            Slot &slot = slots_[index];
+            slot.last_use = ++clock_;
+            size_t in_block = pos - block * block_size_;
+            if (in_block >= slot.length)
+            {
+                break; // File shrank since it was opened
+            }
+            size_t count = std::min(length - copied, slot.length - in_block);
+            std::memcpy(out + copied, slot.buffer.data() + in_block, count);
+            copied += count;
+        }
+
+        // Next block first, forward browsing is the common case
+        wanted_.clear();
+        if (last_block + 1 < block_count_)
+        {
+            wanted_.push_back(last_block + 1);
+        }
+        size_t first_block = offset / block_size_;
+        if (first_block > 0)
+        {
+            wanted_.push_back(first_block - 1);
+        }
+        lock.unlock();
+        wanted_cv_.notify_one();
+        return copied;
+    }
+
+    void BlockPrefetcher::prefetch_loop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            wanted_cv_.wait(lock, [this]
+                            { return stop_ || !wanted_.empty(); });
+            if (stop_)
+            {
+                return;
+            }
+            size_t block = wanted_.front();
+            wanted_.pop_front();
+            if (find_slot(block) != NO_BLOCK)
+            {
+                continue; // Cached or already in flight
+            }
+            size_t index = pick_victim();
+            if (index == NO_BLOCK)
+            {
+                continue;
+            }
+            try
+            {
+                load(index, block, lock);
+                counters_.prefetched++;
+            }
+            catch (const std::exception &)
+            {
+                // The reader will retry synchronously and report the error
+            }
+        }
+    }
+
+    BlockPrefetcher::Counters BlockPrefetcher::counters() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return counters_;
+    }
+
+} // namespace file_client
@@ -0,0 +1,127 @@
+/**
+ * @file block_prefetcher.h
+ * @brief Ring of aligned blocks filled ahead of a reader by a background thread
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Backs the view pager. Every read schedules the blocks just before and just
+ * after it, so stepping forward or backward through a remote file is served
+ * from memory instead of paying a round trip per step.
+ */
+
+#pragma once
+
+#include "aligned_buffer.h"
+#include "filesystem_interface.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace file_client
+{
+
+    /**
+     * @class BlockPrefetcher
+     * @brief Fixed set of block-sized slots with least recently used replacement
+     *
+     * A slot being filled is never handed out or evicted. The caller loads a
+     * block itself when it is neither cached nor in flight, so the background
+     * thread only ever hides latency and never adds to it.
+     */
+    class BlockPrefetcher
+    {
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024; ///< Bytes per slot
+        static constexpr size_t DEFAULT_SLOTS = 8;              ///< Slots in the ring
+
+        /**
+         * @struct Counters
+         * @brief Block lookups served from the ring or read synchronously
+         */
+        struct Counters
+        {
+            uint64_t hits = 0;       ///< Blocks found in the ring
+            uint64_t misses = 0;     ///< Blocks the caller had to read (or wait for)
+            uint64_t prefetched = 0; ///< Blocks read by the background thread
+        };
+
+        /**
+         * @brief Start the background reader
+         * @param fs File system the blocks are read from, must outlive the prefetcher
+         * @param path Resolved file path
+         * @param file_size File size in bytes
+         * @param block_size Slot size, rounded up to the I/O alignment
+         * @param slots Number of slots, at least 3 (current block and both neighbours)
+         */
+        BlockPrefetcher(FileSystemInterface &fs, std::string path, size_t file_size,
+                        size_t block_size = DEFAULT_BLOCK_SIZE, size_t slots = DEFAULT_SLOTS);
+
+        /**
+         * @brief Stop and join the background reader
+         */
+        ~BlockPrefetcher();
+
+        BlockPrefetcher(const BlockPrefetcher &) = delete;
+        BlockPrefetcher &operator=(const BlockPrefetcher &) = delete;
+
+        /**
+         * @brief Copy a range of the file, then prefetch the neighbouring blocks
+         * @param offset File offset
+         * @param length Bytes wanted
+         * @param out Destination, must hold length bytes
+         * @return Bytes copied, short only at end of file
+         * @throw std::runtime_error if a block cannot be read
+         */
+        size_t read(size_t offset, size_t length, char *out);
+
+        size_t file_size() const { return file_size_; }
+        Counters counters() const;
+
+    private:
+        static constexpr size_t NO_BLOCK = SIZE_MAX;
+
+        enum class SlotState
+        {
+            EMPTY,
+            LOADING,
+            READY
+        };
+
+        struct Slot
+        {
+            AlignedBuffer buffer;
+            size_t block = NO_BLOCK;
+            size_t length = 0;
+            SlotState state = SlotState::EMPTY;
+            uint64_t last_use = 0;
+        };
+
+        void prefetch_loop();
+        size_t find_slot(size_t block) const;
+        size_t pick_victim() const;
+        void load(size_t slot_index, size_t block, std::unique_lock<std::mutex> &lock);
+
+        FileSystemInterface &fs_;
+        const std::string path_;
+        const size_t file_size_;
+        const size_t block_size_;
+        const size_t block_count_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable loaded_cv_;  ///< A slot left LOADING
+        std::condition_variable wanted_cv_;  ///< wanted_ grew or stop_ was set
+        std::vector<Slot> slots_;
+        std::deque<size_t> wanted_;          ///< Blocks to prefetch, nearest first
+        uint64_t clock_ = 0;
+        bool stop_ = false;
+        Counters counters_;
+        std::thread thread_;
+    };
+
+} // namespace file_client
@@ -0,0 +1,108 @@
+/**
+ * @file chunked_checksum.h
+ * @brief Parallel chunked CRC32C shared by the SDK and local checksum paths
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Splits a file into aligned chunks, reads and hashes them on several threads
+ * and folds the chunk checksums into the whole-file checksum, so checksums of
+ * the same bytes match no matter which backend read them.
+ */
+
+#pragma once
+
+#include "aligned_buffer.h"
+#include "crc32c.h"
+#include "filesystem_interface.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace file_client
+{
+
+    /**
+     * @brief Checksum size bytes read through read_fully in fixed-size chunks
+     * @param size File size in bytes
+     * @param chunk_size Chunk size in bytes (rounded up to the I/O alignment)
+     * @param depth Chunks in flight, at least 1
+     * @param path File name for error messages
+     * @param read_fully Reads (buffer, length, offset) and returns the bytes read, short only at EOF
+     * @return Per-chunk and whole-file CRC32C
+     * @throw std::runtime_error if read_fully throws or the file shrinks while being read
+     */
+    template <typename ReadFully>
+    FileChecksum checksum_chunks(uint64_t size, size_t chunk_size, size_t depth, const std::string &path,
+                                 ReadFully &&read_fully)
+    {
+        FileChecksum checksum;
+        checksum.size = size;
+        checksum.chunk_size = AlignedBuffer::round_up(std::max(chunk_size, AlignedBuffer::DEFAULT_ALIGNMENT),
+                                                      AlignedBuffer::DEFAULT_ALIGNMENT);
+        const size_t count = (checksum.size + checksum.chunk_size - 1) / checksum.chunk_size;
+        checksum.chunks.resize(count);
+        auto length = [&](size_t k)
+        { return static_cast<size_t>(std::min<uint64_t>(checksum.chunk_size, checksum.size - k * checksum.chunk_size)); };
+
+        // Chunks are independent, so workers claim them in any order and hash them where they were read
+        std::atomic<size_t> next{0};
+        std::atomic<bool> stop{false};
+        std::mutex mutex;
+        std::exception_ptr error;
+        auto worker = [&]
+        {
+            try
+            {
+                AlignedBuffer buffer(checksum.chunk_size);
+                for (size_t k = next++; k < count && !stop; k = next++)
+                {
+                    size_t want = length(k);
+                    if (read_fully(buffer.data(), want, k * checksum.chunk_size) != want)
+                    {
+                        throw std::runtime_error("File shrank while being checksummed: " + path);
+                    }
+                    checksum.chunks[k] = crc32c(buffer.data(), want);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+                stop = true;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < std::min(depth, count); ++t)
+        {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto &thread : workers)
+        {
+            thread.join();
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        // Fold the chunk checksums into the checksum of the whole file
+        for (size_t k = 0; k < count; ++k)
+        {
+            checksum.crc = crc32c_combine(checksum.crc, checksum.chunks[k], length(k));
+        }
+        return checksum;
+    }
+
+} // namespace file_client
@@ -0,0 +1,238 @@
+/**
+ * @file content_type.cpp
+ * @brief File content classification implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "content_type.h"
+#include "innodb_page.h"
+#include "redo_log.h"
+#include "crc32c.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace file_client
+{
+
+    namespace
+    {
+        constexpr size_t BINARY_THRESHOLD_PERCENT = 30;
+
+        /** @name Undo tablespace id range (dict_sys_t in dict0dict.h)
+         * @{ */
+        constexpr uint32_t MAX_UNDO_SPACE_ID = 0xFFFFFFEFUL;
+        constexpr uint32_t MIN_UNDO_SPACE_ID = MAX_UNDO_SPACE_ID - 127 * 512 + 1;
+        /** @} */
+
+        constexpr uint16_t FIL_PAGE_TYPE_FSP_HDR = 8;
+        constexpr uint32_t LOG_HEADER_FORMAT_MAX = 6; ///< LOG_HEADER_FORMAT_8_0_30
+
+        /** Fixed byte signatures, checked in order */
+        struct MagicRule
+        {
+            size_t offset;
+            const char *bytes;
+            size_t length;
+            const char *description;
+        };
+
+        const MagicRule MAGIC_RULES[] = {
+            {0, "\xFE" "bin", 4, "MySQL binary log"},
+            {0, "\x7F" "ELF", 4, "ELF executable"},
+            {0, "\x1F\x8B", 2, "gzip compressed data"},
+            {0, "\x28\xB5\x2F\xFD", 4, "zstd compressed data"},
+            {0, "PK\x03\x04", 4, "zip archive"},
+            {257, "ustar", 5, "tar archive"},
+            {0, "%PDF-", 5, "PDF document"},
+            {0, "\x89PNG\r\n\x1A\n", 8, "PNG image"},
+            {0, "\xFF\xD8\xFF", 3, "JPEG image"},
+            {0, "GIF8", 4, "GIF image"},
+        };
+
+        inline bool is_plain_byte(unsigned char c)
+        {
+            return (c >= 32 && c < 0x80) || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        /** Index of the first byte at or after i that is not printable ASCII, tab or newline */
+        size_t skip_plain_ascii(const unsigned char *data, size_t size, size_t i)
+        {
+#if defined(__x86_64__)
+            // Signed compare: 0x20..0x7F are greater than 0x1F, bytes >= 0x80 are negative
+            const __m128i space_minus_one = _mm_set1_epi8(0x1F);
+            const __m128i tab = _mm_set1_epi8('\t');
+            const __m128i lf = _mm_set1_epi8('\n');
+            const __m128i cr = _mm_set1_epi8('\r');
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                __m128i plain = _mm_or_si128(_mm_cmpgt_epi8(v, space_minus_one),
+                                             _mm_or_si128(_mm_cmpeq_epi8(v, tab),
+                                                          _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr))));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(plain));
+                if (mask != 0xFFFF)
+                {
+                    return i + __builtin_ctz(~mask);
+                }
+            }
+#elif defined(__aarch64__)
+            const int8x16_t space_minus_one = vdupq_n_s8(0x1F);
+            for (; i + 16 <= size; i += 16)
+            {
+                int8x16_t v = vreinterpretq_s8_u8(vld1q_u8(data + i));
+                uint8x16_t plain = vorrq_u8(vcgtq_s8(v, space_minus_one),
+                                            vorrq_u8(vceqq_s8(v, vdupq_n_s8('\t')),
+                                                     vorrq_u8(vceqq_s8(v, vdupq_n_s8('\n')), vceqq_s8(v, vdupq_n_s8('\r')))));
+                if (vminvq_u8(plain) != 0xFF)
+                {
+                    break; // Locate the byte with the scalar loop below
+                }
+            }
+#endif
+            while (i < size && is_plain_byte(data[i]))
+            {
+                i++;
+            }
+            return i;
+        }
+
+        std::string detect_innodb(const unsigned char *data, size_t size)
+        {
+            using namespace innodb;
+            if (size < FSP_SPACE_FLAGS + 4 || read_be16(data + FIL_PAGE_TYPE) != FIL_PAGE_TYPE_FSP_HDR ||
+                read_be32(data + FIL_PAGE_OFFSET) != 0)
+            {
+                return "";
+            }
+            // Page 0 repeats the space id as FSP_SPACE_ID, the first field of the FSP header
+            uint32_t space_id = read_be32(data + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID);
+            if (read_be32(data + FIL_PAGE_DATA) != space_id)
+            {
+                return "";
+            }
+            bool compressed;
+            size_t page_size = page_size_from_flags(read_be32(data + FSP_SPACE_FLAGS), compressed);
+            if (page_size == 0)
+            {
+                return "";
+            }
+
+            const char *kind = "InnoDB tablespace";
+            if (space_id == 0)
+            {
+                kind = "InnoDB system tablespace";
+            }
+            else if (space_id >= MIN_UNDO_SPACE_ID && space_id <= MAX_UNDO_SPACE_ID)
+            {
+                kind = "InnoDB undo tablespace";
+            }
+            return std::string(kind) + ", space id " + std::to_string(space_id) + ", page size " +
+                   std::to_string(page_size) + (compressed ? " compressed" : "");
+        }
+
+        std::string detect_redo(const unsigned char *data, size_t size)
+        {
+            using namespace innodb;
+            if (size < OS_FILE_LOG_BLOCK_SIZE ||
+                read_be32(data + LOG_BLOCK_CHECKSUM) != crc32c(data, LOG_BLOCK_CHECKSUM))
+            {
+                return "";
+            }
+            uint32_t format = read_be32(data + LOG_HEADER_FORMAT);
+            if (format == 0 || format > LOG_HEADER_FORMAT_MAX)
+            {
+                return "";
+            }
+            const char *creator = reinterpret_cast<const char *>(data + LOG_HEADER_CREATOR);
+            return "InnoDB redo log, format " + std::to_string(format) + ", created by " +
+                   std::string(creator, strnlen(creator, LOG_HEADER_CREATOR_LEN));
+        }
+    }
+
+    bool looks_like_text(const unsigned char *data, size_t size)
+    {
+        if (size == 0)
+        {
+            return true;
+        }
+
+        size_t non_printable = 0;
+        size_t i = 0;
+        while (i < size)
+        {
+            i = skip_plain_ascii(data, size, i);
+            if (i >= size)
+            {
+                break;
+            }
+            unsigned char c = data[i];
+
+            // NULL bytes are directly considered binary
+            if (c == 0)
+            {
+                return false;
+            }
+
+            // ASCII control character
+            if (c < 0x80)
+            {
+                non_printable++;
+                i++;
+                continue;
+            }
+
+            // UTF-8 multi-byte sequence
+            size_t utf8_len;
+            if ((c & 0xE0) == 0xC0)
+                utf8_len = 2;
+            else if ((c & 0xF0) == 0xE0)
+                utf8_len = 3;
+            else if ((c & 0xF8) == 0xF0)
+                utf8_len = 4;
+            else
+            {
+                // Invalid UTF-8 starting byte
+                non_printable++;
+                i++;
+                continue;
+            }
+            for (size_t j = 1; j < utf8_len && i + j < size; ++j)
+            {
+                if ((data[i + j] & 0xC0) != 0x80)
+                {
+                    non_printable++;
+                    break;
+                }
+            }
+            i += utf8_len;
+        }
+
+        return non_printable * 100 / size < BINARY_THRESHOLD_PERCENT;
+    }
+
+    std::string detect_content_type(const unsigned char *data, size_t size)
+    {
+        for (const MagicRule &rule : MAGIC_RULES)
+        {
+            if (size >= rule.offset + rule.length && std::memcmp(data + rule.offset, rule.bytes, rule.length) == 0)
+            {
+                return rule.description;
+            }
+        }
+        std::string type = detect_innodb(data, size);
+        if (type.empty())
+        {
+            type = detect_redo(data, size);
+        }
+        return type;
+    }
+
+} // namespace file_client
@@ -0,0 +1,39 @@
+/**
+ * @file content_type.h
+ * @brief File content classification
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Text/binary heuristic with a SIMD fast path over plain ASCII (SSE2 on
+ * x86-64, NEON on AArch64) and a magic-number table that recognizes InnoDB
+ * tablespaces, redo logs and MySQL binary logs by their first bytes rather
+ * than by file extension.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace file_client
+{
+
+    /**
+     * @brief Decide whether data looks like text
+     * @param data Leading bytes of the file
+     * @param size Number of bytes
+     * @return false on a NUL byte or when 30% or more of the bytes are control
+     *         characters or malformed UTF-8 sequences
+     */
+    bool looks_like_text(const unsigned char *data, size_t size);
+
+    /**
+     * @brief Recognize a file format from its leading bytes
+     * @param data Leading bytes of the file, at least the first log block (512 bytes) for redo logs
+     * @param size Number of bytes
+     * @return Format description, empty if no magic matched
+     */
+    std::string detect_content_type(const unsigned char *data, size_t size);
+
+} // namespace file_client
@@ -0,0 +1,216 @@
+/**
+ * @file crc32c.cpp
+ * @brief CRC32C implementation with hardware kernels
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "crc32c.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace file_client
+{
+
+    namespace
+    {
+        constexpr uint32_t POLY = 0x82F63B78; ///< Reflected Castagnoli polynomial
+
+        struct Tables
+        {
+            uint32_t t[8][256];
+
+            Tables()
+            {
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    uint32_t crc = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        crc = (crc >> 1) ^ (POLY & (0 - (crc & 1)));
+                    }
+                    t[0][i] = crc;
+                }
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    for (int k = 1; k < 8; ++k)
+                    {
+                        t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+                    }
+                }
+            }
+        };
+
+        const Tables &tables()
+        {
+            static const Tables instance;
+            return instance;
+        }
+
+        uint64_t load64(const unsigned char *p)
+        {
+            uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value; // Little-endian hosts only, like the rest of the tool
+        }
+
+        uint32_t crc32c_software(uint32_t crc, const unsigned char *p, size_t size)
+        {
+            const Tables &tb = tables();
+            while (size >= 8)
+            {
+                uint64_t word = load64(p) ^ crc;
+                crc = tb.t[7][word & 0xFF] ^ tb.t[6][(word >> 8) & 0xFF] ^
+                      tb.t[5][(word >> 16) & 0xFF] ^ tb.t[4][(word >> 24) & 0xFF] ^
+                      tb.t[3][(word >> 32) & 0xFF] ^ tb.t[2][(word >> 40) & 0xFF] ^
+                      tb.t[1][(word >> 48) & 0xFF] ^ tb.t[0][word >> 56];
+                p += 8;
+                size -= 8;
+            }
+            while (size-- > 0)
+            {
+                crc = (crc >> 8) ^ tb.t[0][(crc ^ *p++) & 0xFF];
+            }
+            return crc;
+        }
+
+#if defined(__x86_64__)
+        __attribute__((target("sse4.2"))) uint32_t crc32c_sse42(uint32_t crc, const unsigned char *p, size_t size)
+        {
+            uint64_t crc64 = crc;
+            while (size >= 8)
+            {
+                crc64 = _mm_crc32_u64(crc64, load64(p));
+                p += 8;
+                size -= 8;
+            }
+            crc = static_cast<uint32_t>(crc64);
+            while (size-- > 0)
+            {
+                crc = _mm_crc32_u8(crc, *p++);
+            }
+            return crc;
+        }
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+        uint32_t crc32c_armv8(uint32_t crc, const unsigned char *p, size_t size)
+        {
+            while (size >= 8)
+            {
+                crc = __crc32cd(crc, load64(p));
+                p += 8;
+                size -= 8;
+            }
+            while (size-- > 0)
+            {
+                crc = __crc32cb(crc, *p++);
+            }
+            return crc;
+        }
+#endif
+
+        /** Product of a and b modulo the polynomial, both in reflected bit order */
+        uint32_t multiply_mod(uint32_t a, uint32_t b)
+        {
+            uint32_t product = 0;
+            for (uint32_t m = 1u << 31; m != 0; m >>= 1)
+            {
+                if (a & m)
+                {
+                    product ^= b;
+                }
+                b = (b >> 1) ^ (POLY & (0 - (b & 1)));
+            }
+            return product;
+        }
+
+        /** x^(2^k) modulo the polynomial for k = 0..63 */
+        struct PowerTable
+        {
+            uint32_t x2k[64];
+
+            PowerTable()
+            {
+                uint32_t p = 1u << 30; // x^1
+                for (auto &entry : x2k)
+                {
+                    entry = p;
+                    p = multiply_mod(p, p);
+                }
+            }
+        };
+
+        /** x^(8 * bytes) modulo the polynomial, the operator that shifts a CRC past that many zero bytes */
+        uint32_t shift_operator(uint64_t bytes)
+        {
+            static const PowerTable powers;
+            uint32_t p = 1u << 31; // x^0
+            for (size_t k = 3; bytes != 0; bytes >>= 1, ++k)
+            {
+                if (bytes & 1)
+                {
+                    p = multiply_mod(powers.x2k[k & 63], p);
+                }
+            }
+            return p;
+        }
+
+        using Kernel = uint32_t (*)(uint32_t, const unsigned char *, size_t);
+
+        struct Dispatch
+        {
+            Kernel kernel = crc32c_software;
+            const char *name = "software";
+
+            Dispatch()
+            {
+#if defined(__x86_64__)
+                if (__builtin_cpu_supports("sse4.2"))
+                {
+                    kernel = crc32c_sse42;
+                    name = "sse4.2";
+                }
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+                kernel = crc32c_armv8;
+                name = "armv8-crc";
+#endif
+            }
+        };
+
+        const Dispatch &dispatch()
+        {
+            static const Dispatch instance;
+            return instance;
+        }
+    }
+
+    uint32_t crc32c_extend(uint32_t crc, const void *data, size_t size)
+    {
+        return ~dispatch().kernel(~crc, static_cast<const unsigned char *>(data), size);
+    }
+
+    uint32_t crc32c(const void *data, size_t size)
+    {
+        return crc32c_extend(0, data, size);
+    }
+
+    uint32_t crc32c_combine(uint32_t crc1, uint32_t crc2, uint64_t size2)
+    {
+        return multiply_mod(shift_operator(size2), crc1) ^ crc2;
+    }
+
+    const char *crc32c_implementation()
+    {
+        return dispatch().name;
+    }
+
+} // namespace file_client
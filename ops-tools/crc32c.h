@@ -0,0 +1,53 @@
+/**
+ * @file crc32c.h
+ * @brief CRC32C (Castagnoli) checksum
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Same polynomial and conventions as InnoDB ut_crc32. Uses the SSE4.2 crc32
+ * instruction on x86-64 or the ARMv8 CRC extension when available, and falls
+ * back to a slicing-by-8 table implementation otherwise.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace file_client
+{
+
+    /**
+     * @brief Compute CRC32C of a buffer
+     * @param data Input bytes
+     * @param size Number of bytes
+     * @return Checksum
+     */
+    uint32_t crc32c(const void *data, size_t size);
+
+    /**
+     * @brief Extend a CRC32C over more data
+     * @param crc Checksum of the preceding bytes (0 for none)
+     * @param data Input bytes
+     * @param size Number of bytes
+     * @return Checksum of the preceding bytes followed by data
+     */
+    uint32_t crc32c_extend(uint32_t crc, const void *data, size_t size);
+
+    /**
+     * @brief Checksum of two concatenated buffers from their individual checksums
+     * @param crc1 Checksum of the first buffer
+     * @param crc2 Checksum of the second buffer
+     * @param size2 Length of the second buffer in bytes
+     * @return Checksum of the first buffer followed by the second
+     * @note Runs in O(log size2), so chunks hashed independently can be folded into a whole-file checksum
+     */
+    uint32_t crc32c_combine(uint32_t crc1, uint32_t crc2, uint64_t size2);
+
+    /**
+     * @brief Name of the kernel selected at startup ("sse4.2", "armv8-crc" or "software")
+     */
+    const char *crc32c_implementation();
+
+} // namespace file_client
@@ -0,0 +1,123 @@
+/**
+ * @file fd_output_buffer.h
+ * @brief Buffered std::streambuf over a raw file descriptor
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * main.cpp points fd 1 at /dev/null to silence the SDK, so batch results are
+ * written through a duplicate of the original stdout. Output is flushed only
+ * when the buffer fills or on an explicit flush, never per line.
+ */
+
+#pragma once
+
+#include <unistd.h>
+#include <cerrno>
+#include <streambuf>
+#include <vector>
+
+namespace file_client
+{
+
+    /**
+     * @class FdOutputBuffer
+     * @brief Block-buffered output stream buffer writing to a file descriptor
+     */
+    class FdOutputBuffer : public std::streambuf
+    {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        /**
+         * @brief Constructor
+         * @param fd Destination descriptor, closed by the destructor when owned
+         * @param owns_fd Whether to close fd on destruction
+         * @param buffer_size Buffer size in bytes
+         */
+        explicit FdOutputBuffer(int fd, bool owns_fd = true, size_t buffer_size = DEFAULT_BUFFER_SIZE)
+            : fd_(fd), owns_fd_(owns_fd), buffer_(buffer_size)
+        {
+            setp(buffer_.data(), buffer_.data() + buffer_.size());
+        }
+
+        ~FdOutputBuffer() override
+        {
+            flush_buffer();
+            if (owns_fd_ && fd_ >= 0)
+            {
+                ::close(fd_);
+            }
+        }
+
+        FdOutputBuffer(const FdOutputBuffer &) = delete;
+        FdOutputBuffer &operator=(const FdOutputBuffer &) = delete;
+
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (!flush_buffer())
+            {
+                return traits_type::eof();
+            }
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+            }
+            return traits_type::not_eof(ch);
+        }
+
+        std::streamsize xsputn(const char *data, std::streamsize count) override
+        {
+            // Large writes bypass the buffer once it is drained
+            if (count >= static_cast<std::streamsize>(buffer_.size()))
+            {
+                if (!flush_buffer() || !write_all(data, static_cast<size_t>(count)))
+                {
+                    return 0;
+                }
+                return count;
+            }
+            return std::streambuf::xsputn(data, count);
+        }
+
+        int sync() override
+        {
+            return flush_buffer() ? 0 : -1;
+        }
+
+    private:
+        bool flush_buffer()
+        {
+            size_t size = static_cast<size_t>(pptr() - pbase());
+            bool ok = size == 0 || write_all(pbase(), size);
+            setp(buffer_.data(), buffer_.data() + buffer_.size());
+            return ok;
+        }
+
+        bool write_all(const char *data, size_t size)
+        {
+            while (size > 0)
+            {
+                ssize_t written = ::write(fd_, data, size);
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    return false;
+                }
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        int fd_;
+        bool owns_fd_;
+        std::vector<char> buffer_;
+    };
+
+} // namespace file_client
@@ -0,0 +1,143 @@
+/**
+ * @file fd_pool.cpp
+ * @brief LRU descriptor pool implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "fd_pool.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <spdb-sdk/file/file_io.h>
+
+namespace file_client
+{
+
+    /**
+     * @brief Owns one SDK descriptor, closed when the last owner goes away
+     */
+    struct FdPool::Handle
+    {
+        int fd;
+
+        explicit Handle(int f) : fd(f) {}
+        ~Handle() { spdb::sdk::file::close(fd); }
+    };
+
+    int FdPool::Lease::fd() const
+    {
+        return handle_ ? handle_->fd : -1;
+    }
+
+    FdPool::FdPool(size_t capacity, IoStats *io_stats)
+        : capacity_(std::max<size_t>(capacity, 1)), io_stats_(io_stats)
+    {
+    }
+
+    FdPool::Lease FdPool::acquire(const std::string &full_path)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(full_path);
+            if (it != index_.end())
+            {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                counters_.hits++;
+                return Lease(it->second->second);
+            }
+        }
+
+        // Open outside the lock, it is a remote round trip
+        auto start = IoStats::Clock::now();
+        int fd = spdb::sdk::file::open(full_path.c_str(), O_RDONLY);
+        if (io_stats_)
+        {
+            io_stats_->record(IoOp::OPEN, start);
+        }
+        if (fd < 0)
+        {
+            return Lease();
+        }
+        auto handle = std::make_shared<Handle>(fd);
+
+        // Declared before the lock so evicted descriptors close after it is released
+        std::vector<std::shared_ptr<Handle>> released;
+        std::lock_guard<std::mutex> lock(mutex_);
+        counters_.opens++;
+        auto it = index_.find(full_path);
+        if (it != index_.end())
+        {
+            // Another thread opened it meanwhile, keep theirs and let ours close
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return Lease(it->second->second);
+        }
+        lru_.emplace_front(full_path, handle);
+        index_[full_path] = lru_.begin();
+        evict_to_capacity(released);
+        return Lease(handle);
+    }
+
+    FdPool::Lease FdPool::lookup(const std::string &full_path)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(full_path);
+        if (it == index_.end())
+        {
+            return Lease();
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        counters_.hits++;
+        return Lease(it->second->second);
+    }
+
+    void FdPool::invalidate(const std::string &full_path)
+    {
+        std::shared_ptr<Handle> released;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(full_path);
+        if (it != index_.end())
+        {
+            released = std::move(it->second->second);
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+    }
+
+    void FdPool::clear()
+    {
+        LruList released;
+        std::lock_guard<std::mutex> lock(mutex_);
+        released.swap(lru_);
+        index_.clear();
+    }
+
+    void FdPool::set_capacity(size_t capacity)
+    {
+        std::vector<std::shared_ptr<Handle>> released;
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = std::max<size_t>(capacity, 1);
+        evict_to_capacity(released);
+    }
+
+    FdPool::Counters FdPool::counters() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Counters result = counters_;
+        result.open_fds = lru_.size();
+        return result;
+    }
+
+    void FdPool::evict_to_capacity(std::vector<std::shared_ptr<Handle>> &released)
+    {
+        while (lru_.size() > capacity_)
+        {
+            index_.erase(lru_.back().first);
+            released.push_back(std::move(lru_.back().second));
+            lru_.pop_back();
+            counters_.evictions++;
+        }
+    }
+
+} // namespace file_client
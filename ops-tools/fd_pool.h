@@ -0,0 +1,132 @@
+/**
+ * @file fd_pool.h
+ * @brief LRU pool of open read-only file descriptors
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Opening a remote file is the most expensive SDK call. The pool keeps
+ * recently used descriptors open, keyed by full path, and hands them out
+ * as RAII leases so successive reads of the same file pay for open once.
+ */
+
+#pragma once
+
+#include "io_stats.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace file_client
+{
+
+    /**
+     * @class FdPool
+     * @brief Thread-safe, capacity-bounded descriptor cache
+     *
+     * An evicted or invalidated descriptor is closed only after its last lease
+     * is released, so a lease stays valid for its whole lifetime. The close is
+     * never issued while the pool lock is held.
+     */
+    class FdPool
+    {
+        struct Handle;
+
+    public:
+        /**
+         * @class Lease
+         * @brief Shared ownership of a pooled descriptor
+         */
+        class Lease
+        {
+        public:
+            Lease() = default;
+
+            int fd() const;
+            explicit operator bool() const { return handle_ != nullptr; }
+
+        private:
+            friend class FdPool;
+            explicit Lease(std::shared_ptr<Handle> handle) : handle_(std::move(handle)) {}
+
+            std::shared_ptr<Handle> handle_;
+        };
+
+        /**
+         * @struct Counters
+         * @brief Pool effectiveness counters
+         */
+        struct Counters
+        {
+            uint64_t hits = 0;      ///< Leases served by an already open descriptor
+            uint64_t opens = 0;     ///< Descriptors opened
+            uint64_t evictions = 0; ///< Descriptors dropped due to capacity
+            size_t open_fds = 0;    ///< Descriptors currently held by the pool
+        };
+
+        static constexpr size_t DEFAULT_CAPACITY = 16; ///< Default number of pooled descriptors
+
+        /**
+         * @brief Constructor
+         * @param capacity Maximum number of pooled descriptors
+         * @param io_stats Receives open latencies, may be null
+         */
+        explicit FdPool(size_t capacity = DEFAULT_CAPACITY, IoStats *io_stats = nullptr);
+        ~FdPool() = default;
+
+        FdPool(const FdPool &) = delete;
+        FdPool &operator=(const FdPool &) = delete;
+
+        /**
+         * @brief Get a read-only descriptor for a path, opening it if needed
+         * @param full_path SDK path
+         * @return Lease, empty if the file cannot be opened
+         */
+        Lease acquire(const std::string &full_path);
+
+        /**
+         * @brief Get the pooled descriptor of a path without opening one
+         * @param full_path SDK path
+         * @return Lease, empty if the path has no pooled descriptor
+         */
+        Lease lookup(const std::string &full_path);
+
+        /**
+         * @brief Drop the pooled descriptor of one path
+         */
+        void invalidate(const std::string &full_path);
+
+        /**
+         * @brief Drop all pooled descriptors
+         */
+        void clear();
+
+        /**
+         * @brief Change capacity, evicting least recently used descriptors if needed
+         */
+        void set_capacity(size_t capacity);
+
+        Counters counters() const;
+
+    private:
+        using LruList = std::list<std::pair<std::string, std::shared_ptr<Handle>>>;
+
+        /**
+         * @brief Drop least recently used descriptors beyond capacity, caller holds mutex_
+         * @param released Receives the dropped handles, so the remote close runs once the lock is released
+         */
+        void evict_to_capacity(std::vector<std::shared_ptr<Handle>> &released);
+
+        mutable std::mutex mutex_;
+        LruList lru_; ///< Most recently used first
+        std::unordered_map<std::string, LruList::iterator> index_;
+        size_t capacity_;
+        Counters counters_;
+        IoStats *io_stats_;
+    };
+
+} // namespace file_client
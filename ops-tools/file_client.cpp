@@ -11,23 +11,57 @@
 
 #include "file_client.h"
 #include "spdb_sdk_filesystem.h"
+#include "innodb_page.h"
+#include "crc32c.h"
+#include "redo_log.h"
+#include "hex_formatter.h"
+#include "content_type.h"
+#include "block_prefetcher.h"
+#include "local_file.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <cctype>
 #include <unordered_map>
+#include <unordered_set>
+#include <map>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <fnmatch.h>
 
 namespace file_client
 {
 
     FileClient::FileClient(std::unique_ptr<FileSystemInterface> fs)
-        : filesystem_(std::move(fs))
+        : filesystem_(std::make_unique<InstrumentedFileSystem>(std::move(fs))),
+          instrumented_(static_cast<InstrumentedFileSystem *>(filesystem_.get())), output_(&std::cerr),
+          workers_(std::make_unique<WorkStealingPool>(DEFAULT_WORKER_THREADS))
     {
     }
 
+    SPDB_SDKFileSystem *FileClient::sdk_filesystem()
+    {
+        return dynamic_cast<SPDB_SDKFileSystem *>(&instrumented_->inner());
+    }
+
+    void FileClient::set_output_stream(std::ostream &out)
+    {
+        output_ = &out;
+    }
+
     CommandResult FileClient::execute_command(const std::string &command_line)
     {
         if (command_line.empty())
@@ -46,12 +80,24 @@ namespace file_client
             {"ll", &FileClient::cmd_ls},
             {"file", &FileClient::cmd_file},
             {"stat", &FileClient::cmd_stat},
-            //{"du", &FileClient::cmd_du},
+            {"du", &FileClient::cmd_du},
+            {"find", &FileClient::cmd_find},
             {"cat", &FileClient::cmd_cat},
             {"cd", &FileClient::cmd_cd},
             {"pwd", &FileClient::cmd_pwd},
             {"hexdump", &FileClient::cmd_hexdump},
+            {"view", &FileClient::cmd_view},
             {"meta", &FileClient::cmd_meta},
+            {"dump", &FileClient::cmd_dump},
+            {"copy-out", &FileClient::cmd_dump},
+            {"pages", &FileClient::cmd_pages},
+            {"redoscan", &FileClient::cmd_redoscan},
+            {"sum", &FileClient::cmd_sum},
+            {"cmp", &FileClient::cmd_cmp},
+            {"cache", &FileClient::cmd_cache},
+            {"iostat", &FileClient::cmd_iostat},
+            {"timing", &FileClient::cmd_timing},
+            {"stats", &FileClient::cmd_stats},
             {"help", &FileClient::cmd_help},
             {"?", &FileClient::cmd_help},
         };
@@ -62,7 +108,30 @@ namespace file_client
         auto it = command_map.find(cmd);
         if (it != command_map.end())
         {
-            return (this->*(it->second))(args); // 调用对应函数
+            bool timed = timing_.load();
+            InstrumentedFileSystem::Snapshot before;
+            std::vector<uint64_t> sdk_before;
+            if (timed)
+            {
+                before = instrumented_->snapshot();
+                sdk_before = sdk_counters();
+            }
+            auto start = std::chrono::steady_clock::now();
+            CommandResult result = (this->*(it->second))(args); // 调用对应函数
+            uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+            commands_run_.fetch_add(1, std::memory_order_relaxed);
+            command_nanos_.fetch_add(nanos, std::memory_order_relaxed);
+            if (timed && timing_.load())
+            {
+                if (!result.message.empty())
+                {
+                    result.message += "\n";
+                }
+                result.message += format_timing(nanos, before, instrumented_->snapshot(), sdk_before);
+            }
+            return result;
         }
         return CommandResult(false, "Unknown command: " + cmd + ", use 'help' for available commands");
     }
@@ -76,17 +145,29 @@ namespace file_client
 
     CommandResult FileClient::cmd_ls(const std::vector<std::string>& args) {
         bool long_format = false;
-        std::string target_path = ".";
+        std::vector<std::string> targets;
 
         for (const auto& arg : args) {
             if (arg == "-l") {
                 long_format = true;
             }
             else if (arg[0] != '-') {
-                target_path = arg;
+                targets.push_back(arg);
             }
         }
+        if (targets.empty()) {
+            targets.push_back(".");
+        }
+
+        std::vector<std::string> paths = expand_paths(targets);
+        bool with_header = paths.size() > 1;
+        return merge_results(run_per_path(paths, [&](const std::string& path) {
+                                 return ls_one(path, long_format, with_header);
+                             }),
+                             "\n");
+    }
 
+    CommandResult FileClient::ls_one(const std::string& target_path, bool long_format, bool with_header) {
         try {
             std::string resolved_path = filesystem_->resolve_path(target_path);
 
@@ -110,12 +191,16 @@ namespace file_client
                 return CommandResult(true, oss.str());
             }
 
-            auto files = filesystem_->list_directory(resolved_path);
+            // The short format needs only names and types, which readdir may already provide
+            auto files = long_format ? filesystem_->list_directory_with_stats(resolved_path)
+                                     : filesystem_->list_directory(resolved_path);
+            std::string header = with_header ? target_path + ":\n" : "";
             if (files.empty()) {
-                return CommandResult(true, "Directory is empty");
+                return CommandResult(true, header + "Directory is empty");
             }
 
             std::ostringstream result;
+            result << header;
 
             if (long_format) {
                 for (const auto& file : files) {
@@ -175,11 +260,15 @@ namespace file_client
     {
         if (args.empty())
         {
-            return CommandResult(false, "Usage: file <filename>");
+            return CommandResult(false, "Usage: file <filename>...");
         }
+        return merge_results(run_per_path(expand_paths(args), [this](const std::string &path)
+                                          { return file_one(path); }),
+                             "\n");
+    }
 
-        const std::string &filename = args[0];
-
+    CommandResult FileClient::file_one(const std::string &filename)
+    {
         try
         {
             std::string resolved_path = filesystem_->resolve_path(filename);
@@ -209,8 +298,13 @@ namespace file_client
                         result << ", binary file";
                     }
 
-                    // Add more information based on file extension
-                    std::string mime_type = get_file_mime_type(filename);
+                    // Known formats by content first (ibd, redo, binlog, ...), then by file extension
+                    std::string mime_type = detect_content_type(
+                        reinterpret_cast<const unsigned char *>(content.data()), content.size());
+                    if (mime_type.empty())
+                    {
+                        mime_type = get_file_mime_type(filename);
+                    }
                     if (!mime_type.empty())
                     {
                         result << " (" << mime_type << ")";
@@ -233,11 +327,15 @@ namespace file_client
     {
         if (args.empty())
         {
-            return CommandResult(false, "Usage: stat <filename>");
+            return CommandResult(false, "Usage: stat <filename>...");
         }
+        return merge_results(run_per_path(expand_paths(args), [this](const std::string &path)
+                                          { return stat_one(path); }),
+                             "\n");
+    }
 
-        const std::string &filename = args[0];
-
+    CommandResult FileClient::stat_one(const std::string &filename)
+    {
         try
         {
             std::string resolved_path = filesystem_->resolve_path(filename);
@@ -276,18 +374,40 @@ namespace file_client
     CommandResult FileClient::cmd_du(const std::vector<std::string> &args)
     {
         bool human_readable = false;
+        int max_depth = 0;
+        size_t threads = FileSystemInterface::DEFAULT_WALK_THREADS;
         std::string target_path = ".";
 
         // Parse arguments
-        for (const auto &arg : args)
+        for (size_t i = 0; i < args.size(); ++i)
         {
-            if (arg == "-h")
+            const std::string &arg = args[i];
+            try
             {
-                human_readable = true;
+                if (arg == "-h")
+                {
+                    human_readable = true;
+                }
+                else if (arg == "--max-depth" && i + 1 < args.size())
+                {
+                    max_depth = std::stoi(args[++i]);
+                }
+                else if (arg.rfind("--max-depth=", 0) == 0)
+                {
+                    max_depth = std::stoi(arg.substr(12));
+                }
+                else if (arg == "-j" && i + 1 < args.size())
+                {
+                    threads = std::max(1, std::stoi(args[++i]));
+                }
+                else if (arg[0] != '-')
+                {
+                    target_path = arg;
+                }
             }
-            else if (arg[0] != '-')
+            catch (const std::exception &)
             {
-                target_path = arg;
+                return CommandResult(false, "Invalid value for " + arg);
             }
         }
 
@@ -300,19 +420,128 @@ namespace file_client
                 return CommandResult(false, "Path does not exist: " + target_path);
             }
 
-            uint64_t size = 0;
-            if (filesystem_->is_directory(resolved_path))
+            if (!filesystem_->is_directory(resolved_path))
             {
-                size = filesystem_->get_directory_size(resolved_path, true);
+                uint64_t size = filesystem_->get_file_size(resolved_path);
+                return CommandResult(true, FileSystemInterface::format_file_size(size, human_readable) + "\t" + target_path);
             }
-            else
+
+            std::ostringstream result;
+            auto usage = filesystem_->get_directory_usage(resolved_path, max_depth, threads);
+            for (size_t i = 0; i < usage.size(); ++i)
+            {
+                const auto &dir = usage[i];
+                if (i > 0)
+                {
+                    result << "\n";
+                }
+                result << FileSystemInterface::format_file_size(dir.size, human_readable) << "\t"
+                       << (dir.path.empty() ? target_path : target_path + "/" + dir.path);
+            }
+            return CommandResult(true, result.str());
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::cmd_find(const std::vector<std::string> &args)
+    {
+        FindQuery query;
+        size_t threads = FileSystemInterface::DEFAULT_WALK_THREADS;
+        std::string target_path = ".";
+
+        // Parse arguments
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            const std::string &arg = args[i];
+            try
+            {
+                if (arg == "-name" && i + 1 < args.size())
+                {
+                    query.name_glob = args[++i];
+                    // Words are split on whitespace only, so drop the quotes a shell user would type
+                    const std::string &glob = query.name_glob;
+                    if (glob.size() >= 2 && (glob.front() == '\'' || glob.front() == '"') && glob.back() == glob.front())
+                    {
+                        query.name_glob = glob.substr(1, glob.size() - 2);
+                    }
+                }
+                else if (arg == "-type" && i + 1 < args.size())
+                {
+                    const std::string &type = args[++i];
+                    if (type == "f")
+                    {
+                        query.type = FileType::REGULAR_FILE;
+                    }
+                    else if (type == "d")
+                    {
+                        query.type = FileType::DIRECTORY;
+                    }
+                    else
+                    {
+                        return CommandResult(false, "Unsupported -type " + type + ", use f or d");
+                    }
+                }
+                else if (arg == "-size" && i + 1 < args.size())
+                {
+                    std::string size = args[++i];
+                    query.size_compare = 0;
+                    if (!size.empty() && (size[0] == '+' || size[0] == '-'))
+                    {
+                        query.size_compare = size[0] == '+' ? 1 : -1;
+                        size = size.substr(1);
+                    }
+                    if (!parse_size(size, query.size))
+                    {
+                        return CommandResult(false, "Invalid value for -size");
+                    }
+                    query.has_size = true;
+                }
+                else if (arg == "-maxdepth" && i + 1 < args.size())
+                {
+                    query.max_depth = std::stoi(args[++i]);
+                }
+                else if (arg == "-j" && i + 1 < args.size())
+                {
+                    threads = std::max(1, std::stoi(args[++i]));
+                }
+                else if (arg[0] != '-')
+                {
+                    target_path = arg;
+                }
+                else
+                {
+                    return CommandResult(false, "Unknown option " + arg +
+                                                    ", usage: find [path] [-name G] [-type f|d] [-size [+|-]N] [-maxdepth N] [-j N]");
+                }
+            }
+            catch (const std::exception &)
             {
-                size = filesystem_->get_file_size(resolved_path);
+                return CommandResult(false, "Invalid value for " + arg);
             }
+        }
 
-            std::string size_str = FileSystemInterface::format_file_size(size, human_readable);
+        try
+        {
+            std::string resolved_path = filesystem_->resolve_path(target_path);
+            if (!filesystem_->exists(resolved_path))
+            {
+                return CommandResult(false, "Path does not exist: " + target_path);
+            }
+            auto found = filesystem_->find(resolved_path, query, threads);
 
-            return CommandResult(true, size_str + "\t" + target_path);
+            std::ostringstream result;
+            for (size_t i = 0; i < found.size(); ++i)
+            {
+                if (i > 0)
+                {
+                    result << "\n";
+                }
+                result << (found[i].path.empty() ? target_path : target_path + "/" + found[i].path);
+            }
+            return CommandResult(true, result.str());
         }
         catch (const std::exception &e)
         {
@@ -322,12 +551,18 @@ namespace file_client
 
     CommandResult FileClient::cmd_cat(const std::vector<std::string> &args)
     {
-        if (args.empty())
+        size_t file_offset = 0;
+        size_t read_length = 0; // 0 means read to end
+        std::string filename;
+        std::string error = parse_range_args(args, file_offset, read_length, filename);
+        if (!error.empty())
         {
-            return CommandResult(false, "Usage: cat <filename>");
+            return CommandResult(false, error);
+        }
+        if (filename.empty())
+        {
+            return CommandResult(false, "Usage: cat [-offset N] [-len N] <filename>");
         }
-
-        const std::string &filename = args[0];
 
         try
         {
@@ -343,21 +578,38 @@ namespace file_client
                 return CommandResult(false, filename + " is a directory, cannot display content");
             }
 
-            // Limit maximum read size to 1MB to avoid memory issues
-            std::string content = filesystem_->read_file_content(resolved_path, 1024 * 1024);
+            bool binary = false;
+            char last_char = '\n';
+            size_t total = filesystem_->read_file_chunks(
+                resolved_path, file_offset, read_length,
+                [&](const char *data, size_t size, size_t offset)
+                {
+                    // Check if it's a binary file before anything is written
+                    if (offset == file_offset &&
+                        !looks_like_text(reinterpret_cast<const unsigned char *>(data), std::min(size, size_t(512))))
+                    {
+                        binary = true;
+                        return false;
+                    }
+                    output_->write(data, size);
+                    last_char = data[size - 1];
+                    return true;
+                });
 
-            if (content.empty())
+            if (binary)
+            {
+                return CommandResult(false, filename + " is a binary file, cannot display");
+            }
+            if (total == 0)
             {
                 return CommandResult(true, "File is empty");
             }
-
-            // Check if it's a binary file
-            if (!is_text_file(content))
+            if (last_char != '\n')
             {
-                return CommandResult(false, filename + " is a binary file, cannot display");
+                output_->put('\n');
             }
-
-            return CommandResult(true, content);
+            output_->flush();
+            return CommandResult(true, "");
         }
         catch (const std::exception &e)
         {
@@ -375,7 +627,7 @@ namespace file_client
         }
 
         // Check if trying to access above root directory
-        SPDB_SDKFileSystem *spdb_sdk_fs = dynamic_cast<SPDB_SDKFileSystem *>(filesystem_.get());
+        SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
         if (spdb_sdk_fs && spdb_sdk_fs->is_trying_to_escape_root(target_path))
         {
             return CommandResult(false, "Access denied: Cannot navigate above the root directory (" + target_path + ").\nCurrent root directory restricts access to its subdirectories only.");
@@ -396,51 +648,59 @@ namespace file_client
         return CommandResult(true, filesystem_->get_current_directory());
     }
 
-    CommandResult FileClient::cmd_hexdump(const std::vector<std::string> &args)
+    CommandResult FileClient::cmd_view(const std::vector<std::string> &args)
     {
-        if (args.empty())
-        {
-            return CommandResult(false, "Usage: hexdump [-offset N] [-len N] <filename>");
-        }
-        size_t file_offset = 0;
-        size_t read_length = 0; // 0 means read to end
+        const std::string usage = "Usage: view [-text] [-len N] [-offset N] [-page-size N] <filename>";
+        bool text_mode = false;
+        size_t window = DEFAULT_VIEW_WINDOW;
+        size_t offset = 0;
+        size_t page_size = innodb::UNIV_PAGE_SIZE_DEF;
         std::string filename;
-        // Parse arguments
         for (size_t i = 0; i < args.size(); ++i)
         {
-            if (args[i] == "-offset" && i + 1 < args.size())
+            const std::string &arg = args[i];
+            try
             {
-                try
+                if (arg == "-text")
                 {
-                    file_offset = std::stoull(args[i + 1]);
-                    i++; // Skip next parameter
+                    text_mode = true;
                 }
-                catch (const std::exception &)
+                else if (arg == "-len" && i + 1 < args.size())
                 {
-                    return CommandResult(false, "Invalid offset value: " + args[i + 1]);
+                    window = std::stoull(args[++i], nullptr, 0);
                 }
-            }
-            else if (args[i] == "-len" && i + 1 < args.size())
-            {
-                try
+                else if (arg == "-offset" && i + 1 < args.size())
                 {
-                    read_length = std::stoull(args[i + 1]);
-                    i++; // Skip next parameter
+                    offset = std::stoull(args[++i], nullptr, 0);
                 }
-                catch (const std::exception &)
+                else if (arg == "-page-size" && i + 1 < args.size())
+                {
+                    page_size = std::stoull(args[++i], nullptr, 0);
+                }
+                else if (arg[0] != '-')
                 {
-                    return CommandResult(false, "Invalid length value: " + args[i + 1]);
+                    filename = arg;
+                }
+                else
+                {
+                    return CommandResult(false, usage);
                 }
             }
-            else if (args[i][0] != '-')
+            catch (const std::exception &)
             {
-                filename = args[i];
+                return CommandResult(false, "Invalid value for " + arg);
             }
         }
-        if (filename.empty())
+        if (filename.empty() || window == 0 || page_size == 0)
+        {
+            return CommandResult(false, usage);
+        }
+        if (window > MAX_VIEW_WINDOW)
         {
-            return CommandResult(false, "Usage: hexdump [-offset N] [-len N] <filename>");
+            // The prefetcher keeps several blocks of at least one screen each in memory
+            return CommandResult(false, "-len is limited to " + std::to_string(MAX_VIEW_WINDOW) + " bytes per screen");
         }
+
         try
         {
             std::string resolved_path = filesystem_->resolve_path(filename);
@@ -450,77 +710,93 @@ namespace file_client
             }
             if (filesystem_->is_directory(resolved_path))
             {
-                return CommandResult(false, filename + " is a directory, cannot hexdump");
+                return CommandResult(false, filename + " is a directory, cannot view");
             }
-            // Read file content using specified offset and length
-            std::string content;
-            if (file_offset > 0 || read_length > 0)
+            size_t file_size = filesystem_->get_file_size(resolved_path);
+
+            // Blocks cover several screens so a step usually stays inside the current block
+            BlockPrefetcher prefetcher(*filesystem_, resolved_path, file_size,
+                                       std::max(BlockPrefetcher::DEFAULT_BLOCK_SIZE, window));
+            const HexFormatter formatter(HexdumpMode::CANONICAL);
+            std::vector<char> data(window);
+            std::vector<char> text((window / formatter.bytes_per_line() + 2) * formatter.max_line_length());
+
+            auto show = [&]()
             {
-                // Limit maximum read length to avoid memory issues
-                size_t max_read_length = read_length;
-                if (max_read_length == 0 || max_read_length > 1024 * 1024)
+                size_t count = prefetcher.read(offset, window, data.data());
+                if (text_mode)
                 {
-                    max_read_length = 1024 * 1024;
+                    output_->write(data.data(), count);
+                    *output_ << '\n';
                 }
-                content = filesystem_->read_file_content_at_offset(resolved_path, file_offset, max_read_length);
-            }
-            else
-            {
-                // Use original method, limit to maximum 1MB
-                content = filesystem_->read_file_content(resolved_path, 1024 * 1024);
-            }
-            if (content.empty())
-            {
-                return CommandResult(true, "No data to display (file empty or offset beyond file size)");
-            }
-
-            std::ostringstream result;
-            const size_t bytes_per_line = 8; // Display 8 bytes per line, balancing readability and width
+                else
+                {
+                    output_->write(text.data(), formatter.format(reinterpret_cast<const unsigned char *>(data.data()),
+                                                                 count, offset, text.data()));
+                }
+                *output_ << "-- " << filename << " offset " << offset << "-" << offset + count << " of " << file_size
+                         << ", page " << offset / page_size << " --" << std::endl;
+            };
 
-            for (size_t line_offset = 0; line_offset < content.size(); line_offset += bytes_per_line)
+            size_t steps = 1;
+            show();
+            if (isatty(STDIN_FILENO))
             {
-                // Display actual file offset address (8-digit hexadecimal)
-                size_t actual_offset = file_offset + line_offset;
-                result << std::hex << std::setfill('0') << std::setw(8) << actual_offset << ": ";
-
-                // Display binary bytes
-                std::string ascii_part;
-                for (size_t i = 0; i < bytes_per_line; ++i)
+                std::string line;
+                while (std::cerr << "view> " && std::getline(std::cin, line))
                 {
-                    if (line_offset + i < content.size())
+                    std::istringstream keys(line);
+                    std::string key;
+                    keys >> key;
+                    if (key == "q")
                     {
-                        unsigned char byte = static_cast<unsigned char>(content[line_offset + i]);
-
-                        // Convert byte to 8-bit binary representation
-                        for (int bit = 7; bit >= 0; --bit)
+                        break;
+                    }
+                    try
+                    {
+                        if (key.empty() || key == "n")
                         {
-                            result << ((byte >> bit) & 1);
+                            if (offset + window < file_size)
+                            {
+                                offset += window;
+                            }
                         }
-                        result << " "; // Add space after each byte
-
-                        // Prepare ASCII part - printable characters show original, non-printable show dots
-                        if (std::isprint(byte))
+                        else if (key == "b")
+                        {
+                            offset = offset >= window ? offset - window : 0;
+                        }
+                        else if (key == "o" || key == "pg")
                         {
-                            ascii_part += static_cast<char>(byte);
+                            std::string value;
+                            keys >> value;
+                            size_t target = std::stoull(value, nullptr, 0) * (key == "pg" ? page_size : 1);
+                            if (target >= file_size)
+                            {
+                                std::cerr << "Beyond end of file (" << file_size << " bytes)" << std::endl;
+                                continue;
+                            }
+                            offset = target;
                         }
                         else
                         {
-                            ascii_part += '.';
+                            std::cerr << "Keys: Enter/n next, b previous, o <offset>, pg <page>, q quit" << std::endl;
+                            continue;
                         }
                     }
-                    else
+                    catch (const std::exception &)
                     {
-                        // Fill with blanks to maintain alignment (8-bit binary + 1 space)
-                        result << "         ";
-                        ascii_part += " ";
+                        std::cerr << "Invalid value in: " << line << std::endl;
+                        continue;
                     }
+                    show();
+                    steps++;
                 }
-
-                // Display ASCII characters
-                result << " " << ascii_part << "\n";
             }
 
-            return CommandResult(true, result.str());
+            BlockPrefetcher::Counters counters = prefetcher.counters();
+            return CommandResult(true, "view: " + std::to_string(steps) + " screens, " +
+                                           std::to_string(counters.hits) + " block lookups served from memory, " +
+                                           std::to_string(counters.misses) + " read synchronously");
         }
         catch (const std::exception &e)
         {
@@ -528,101 +804,1477 @@ namespace file_client
         }
     }
 
-    CommandResult FileClient::cmd_meta(const std::vector<std::string> &args)
+    CommandResult FileClient::cmd_hexdump(const std::vector<std::string> &args)
     {
+        const std::string usage = "Usage: hexdump [-C] [-w N] [-offset N] [-len N] <filename>";
         if (args.empty())
         {
-            return CommandResult(false, "Usage: meta <filename>");
+            return CommandResult(false, usage);
         }
 
-        const std::string &filename = args[0];
-
-        try
+        // Layout options are stripped before the shared range parser sees them
+        HexdumpMode mode = HexdumpMode::BINARY;
+        size_t width = 0; // 0 selects the mode default
+        std::vector<std::string> range_args;
+        for (size_t i = 0; i < args.size(); ++i)
         {
-            std::string resolved_path = filesystem_->resolve_path(filename);
-
-            // 检查文件是否支持元数据
-            if (!filesystem_->has_file_metadata(resolved_path))
+            if (args[i] == "-C")
             {
-                if (!filesystem_->exists(resolved_path))
+                mode = HexdumpMode::CANONICAL;
+            }
+            else if (args[i] == "-w" && i + 1 < args.size())
+            {
+                try
                 {
-                    return CommandResult(false, "File does not exist: " + filename);
+                    width = std::stoul(args[++i]);
                 }
-                else if (filesystem_->is_directory(resolved_path))
+                catch (const std::exception &)
                 {
-                    return CommandResult(false, filename + " is a directory, cannot get metadata");
+                    return CommandResult(false, "Invalid width value: " + args[i]);
                 }
-                else
+                if (width == 0 || width > HexFormatter::MAX_BYTES_PER_LINE)
                 {
-                    return CommandResult(false, "Unsupported file type. Only redolog and IBD files have metadata.\n"
-                                               "Supported: *.ibd files, #ib_redo* files");
+                    return CommandResult(false, "Width must be between 1 and " +
+                                                    std::to_string(HexFormatter::MAX_BYTES_PER_LINE));
                 }
             }
-
-            // 获取文件元数据
-            std::string metadata = filesystem_->get_file_metadata(resolved_path);
-            return CommandResult(true, metadata);
-        }
-        catch (const std::exception &e)
-        {
-            return CommandResult(false, "Error: " + std::string(e.what()));
+            else
+            {
+                range_args.push_back(args[i]);
+            }
         }
-    }
-
-    CommandResult FileClient::cmd_help(const std::vector<std::string> &)
-    {
-        std::ostringstream help;
-        help << "File Client Tool - Available Commands:\n\n"
-             << "Directory Operations:\n"
-             << "  ls [path]                List directory contents\n"
-             << "  ls -l [path]             List detailed directory contents (permissions, size, time)\n"
-             << "  ll                       List directory contents\n"
-             << "  cd [path]                Change directory\n"
-             << "  pwd                      Show current directory\n\n"
-             << "File Information:\n"
-             << "  file <filename>          Show file type\n"
-             << "  meta <filename>          Show file meta infomation (only redo, ibd)\n"
-             << "  stat <filename>          Show detailed file information\n\n"
-             << "File Content:\n"
-             << "  cat <filename>           Display file content\n"
-             << "  hexdump <filename>       Display hexadecimal dump of file\n"
-             << "    hexdump -len -offset <filename>\n\n"
-             << "Other:\n"
-             << "  help                     Show this help message\n"
-             << "  exit/quit                Exit the program\n\n"
-             << "Note: Access is restricted to the specified root directory";
 
-        return CommandResult(true, help.str());
-    }
-
-    void FileClient::run_interactive()
-    {
-        SPDB_SDKFileSystem *spdb_sdk_fs = dynamic_cast<SPDB_SDKFileSystem *>(filesystem_.get());
-        if (spdb_sdk_fs)
+        size_t file_offset = 0;
+        size_t read_length = 0; // 0 means read to end
+        std::string filename;
+        std::string error = parse_range_args(range_args, file_offset, read_length, filename);
+        if (!error.empty())
         {
-            std::cerr << "File Client Tool started (Root directory: " << spdb_sdk_fs->get_real_system_path() << ")\n";
+            return CommandResult(false, error);
         }
-        else
+        if (filename.empty())
         {
-            std::cerr << "File Client Tool started\n";
+            return CommandResult(false, usage);
         }
-        std::cerr << "Type 'help' for available commands, 'exit' to quit\n\n";
-        std::string input;
-        while (true)
+        try
         {
-            std::cerr << get_prompt(); // 打印提示符
-            if (!std::getline(std::cin, input))
+            std::string resolved_path = filesystem_->resolve_path(filename);
+            if (!filesystem_->exists(resolved_path))
             {
-                break; // EOF or input error
+                return CommandResult(false, "File does not exist: " + filename);
             }
-            auto result = execute_command(input);
-            if (result.message == "exit")
+            if (filesystem_->is_directory(resolved_path))
             {
-                break; // Exit command
+                return CommandResult(false, filename + " is a directory, cannot hexdump");
             }
-            if (!result.success)
+
+            const HexFormatter formatter(mode, width);
+            const size_t bytes_per_line = formatter.bytes_per_line();
+
+            // Lines are formatted into one reusable buffer and written with a single call per chunk
+            static constexpr size_t LINES_PER_WRITE = 4096;
+            std::vector<char> text(LINES_PER_WRITE * formatter.max_line_length());
+            auto emit = [&](const unsigned char *data, size_t size, size_t offset)
             {
-                std::cerr << "Error: " << result.message << std::endl;
+                const size_t step = LINES_PER_WRITE * bytes_per_line;
+                for (size_t pos = 0; pos < size; pos += step)
+                {
+                    size_t count = std::min(step, size - pos);
+                    output_->write(text.data(), formatter.format(data + pos, count, offset + pos, text.data()));
+                }
+            };
+
+            // Chunks may end in the middle of a line, carry the tail over to the next chunk
+            std::vector<unsigned char> carry(bytes_per_line);
+            size_t carry_len = 0;
+            size_t carry_offset = file_offset;
+
+            size_t total = filesystem_->read_file_chunks(
+                resolved_path, file_offset, read_length,
+                [&](const char *chunk, size_t size, size_t offset)
+                {
+                    const unsigned char *data = reinterpret_cast<const unsigned char *>(chunk);
+                    if (carry_len > 0)
+                    {
+                        size_t take = std::min(bytes_per_line - carry_len, size);
+                        std::copy(data, data + take, carry.data() + carry_len);
+                        carry_len += take;
+                        data += take;
+                        size -= take;
+                        offset += take;
+                        if (carry_len < bytes_per_line)
+                        {
+                            return true;
+                        }
+                        emit(carry.data(), carry_len, carry_offset);
+                        carry_len = 0;
+                    }
+                    size_t whole = size - size % bytes_per_line;
+                    emit(data, whole, offset);
+                    carry_len = size - whole;
+                    carry_offset = offset + whole;
+                    std::copy(data + whole, data + size, carry.data());
+                    return true;
+                });
+
+            if (carry_len > 0)
+            {
+                emit(carry.data(), carry_len, carry_offset);
+            }
+            if (total == 0)
+            {
+                return CommandResult(true, "No data to display (file empty or offset beyond file size)");
+            }
+            output_->write(text.data(), formatter.format_end(file_offset + total, text.data()));
+            output_->flush();
+            return CommandResult(true, "");
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::cmd_dump(const std::vector<std::string> &args)
+    {
+        const std::string usage = "Usage: dump [-j N] [-f] [-offset N] [-len N] <filename> <local_path>";
+        static constexpr size_t DUMP_REQUEST_SIZE = 4 * 1024 * 1024; // Bytes per sub-request
+
+        size_t depth = 0; // 0 uses the filesystem's configured depth
+        bool overwrite = false;
+        std::vector<std::string> range_args;
+        std::vector<std::string> paths;
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            if (args[i] == "-j" && i + 1 < args.size())
+            {
+                try
+                {
+                    depth = std::stoul(args[++i]);
+                }
+                catch (const std::exception &)
+                {
+                    return CommandResult(false, "Invalid value for -j: " + args[i]);
+                }
+            }
+            else if (args[i] == "-f")
+            {
+                overwrite = true;
+            }
+            else if ((args[i] == "-offset" || args[i] == "-len") && i + 1 < args.size())
+            {
+                range_args.push_back(args[i]);
+                range_args.push_back(args[++i]);
+            }
+            else
+            {
+                paths.push_back(args[i]);
+            }
+        }
+        if (paths.size() != 2)
+        {
+            return CommandResult(false, usage);
+        }
+        size_t file_offset = 0;
+        size_t read_length = 0; // 0 means read to end
+        std::string ignored;
+        std::string error = parse_range_args(range_args, file_offset, read_length, ignored);
+        if (!error.empty())
+        {
+            return CommandResult(false, error);
+        }
+
+        const std::string &filename = paths[0];
+        const std::string &local_path = paths[1];
+        try
+        {
+            std::string resolved_path = filesystem_->resolve_path(filename);
+            if (!filesystem_->exists(resolved_path))
+            {
+                return CommandResult(false, "File does not exist: " + filename);
+            }
+            if (filesystem_->is_directory(resolved_path))
+            {
+                return CommandResult(false, filename + " is a directory, cannot dump");
+            }
+
+            // The destination is on the local disk, outside the SDK root
+            int flags = O_WRONLY | O_CREAT | (overwrite ? O_TRUNC : O_EXCL);
+            int out_fd = ::open(local_path.c_str(), flags, 0644);
+            if (out_fd < 0)
+            {
+                return CommandResult(false, "Cannot create " + local_path + ": " + std::strerror(errno) +
+                                                (errno == EEXIST ? " (use -f to overwrite)" : ""));
+            }
+
+            auto started = std::chrono::steady_clock::now();
+            size_t total = 0;
+            try
+            {
+                total = filesystem_->read_file_range_parallel(
+                    resolved_path, file_offset, read_length,
+                    [&](const char *chunk, size_t size, size_t)
+                    {
+                        while (size > 0)
+                        {
+                            ssize_t written = ::write(out_fd, chunk, size);
+                            if (written < 0)
+                            {
+                                if (errno == EINTR)
+                                {
+                                    continue;
+                                }
+                                throw std::runtime_error("write to " + local_path + " failed: " + std::strerror(errno));
+                            }
+                            chunk += written;
+                            size -= static_cast<size_t>(written);
+                        }
+                        return true;
+                    },
+                    DUMP_REQUEST_SIZE, depth);
+                if (::close(out_fd) != 0)
+                {
+                    out_fd = -1;
+                    throw std::runtime_error("close of " + local_path + " failed: " + std::strerror(errno));
+                }
+            }
+            catch (...)
+            {
+                // Never leave a truncated copy behind that looks complete
+                if (out_fd >= 0)
+                {
+                    ::close(out_fd);
+                }
+                ::unlink(local_path.c_str());
+                throw;
+            }
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+            std::ostringstream result;
+            result << "Copied " << total << " bytes from " << filename << " to " << local_path
+                   << " in " << std::fixed << std::setprecision(2) << elapsed << " s ("
+                   << std::setprecision(1) << (elapsed > 0 ? total / elapsed / (1024 * 1024) : 0.0) << " MB/s)";
+            return CommandResult(true, result.str());
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::cmd_pages(const std::vector<std::string> &args)
+    {
+        const std::string usage = "Usage: pages [--range a-b] [--page-size N] [-v] <file.ibd>";
+        static constexpr size_t BATCH_PAGES = 64; // Pages per sequential read
+
+        std::string filename;
+        uint64_t first_page = 0;
+        uint64_t last_page = UINT64_MAX;
+        size_t page_size = 0;
+        bool verbose = false;
+
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            try
+            {
+                if (args[i] == "--range" && i + 1 < args.size())
+                {
+                    const std::string &range = args[++i];
+                    size_t dash = range.find('-');
+                    first_page = std::stoull(range.substr(0, dash));
+                    if (dash == std::string::npos)
+                    {
+                        last_page = first_page;
+                    }
+                    else if (dash + 1 < range.size())
+                    {
+                        last_page = std::stoull(range.substr(dash + 1));
+                    }
+                }
+                else if (args[i] == "--page-size" && i + 1 < args.size())
+                {
+                    page_size = std::stoull(args[++i]);
+                }
+                else if (args[i] == "-v")
+                {
+                    verbose = true;
+                }
+                else if (args[i][0] != '-')
+                {
+                    filename = args[i];
+                }
+            }
+            catch (const std::exception &)
+            {
+                return CommandResult(false, "Invalid value for " + args[i - 1] + ": " + args[i]);
+            }
+        }
+        if (filename.empty())
+        {
+            return CommandResult(false, usage);
+        }
+        if (first_page > last_page)
+        {
+            return CommandResult(false, "Invalid page range");
+        }
+        if (page_size != 0 && (page_size < 1024 || page_size > innodb::UNIV_PAGE_SIZE_MAX || (page_size & (page_size - 1))))
+        {
+            return CommandResult(false, "Page size must be a power of two between 1024 and 65536");
+        }
+
+        try
+        {
+            std::string resolved_path = filesystem_->resolve_path(filename);
+            if (!filesystem_->exists(resolved_path))
+            {
+                return CommandResult(false, "File does not exist: " + filename);
+            }
+            if (filesystem_->is_directory(resolved_path))
+            {
+                return CommandResult(false, filename + " is a directory, cannot scan pages");
+            }
+
+            uint64_t file_size = filesystem_->get_file_size(resolved_path);
+            if (file_size < innodb::FIL_PAGE_DATA + 64)
+            {
+                return CommandResult(false, filename + " is too small to be a tablespace");
+            }
+
+            // Page size comes from the tablespace flags in page 0 unless overridden
+            bool compressed = false;
+            if (page_size == 0)
+            {
+                std::string page0 = filesystem_->read_file_content_at_offset(resolved_path, 0, innodb::FSP_SPACE_FLAGS + 4);
+                uint32_t flags = innodb::read_be32(reinterpret_cast<const unsigned char *>(page0.data()) + innodb::FSP_SPACE_FLAGS);
+                page_size = innodb::page_size_from_flags(flags, compressed);
+                if (page_size == 0)
+                {
+                    std::ostringstream message;
+                    message << "Page 0 of " << filename << " has invalid tablespace flags 0x" << std::hex << flags
+                            << ", pass the page size with --page-size";
+                    return CommandResult(false, message.str());
+                }
+            }
+
+            uint64_t total_pages = file_size / page_size;
+            if (total_pages == 0 || first_page >= total_pages)
+            {
+                return CommandResult(false, "Page range is beyond the end of file (" + std::to_string(total_pages) + " pages)");
+            }
+            last_page = std::min(last_page, total_pages - 1);
+
+            std::map<innodb::PageStatus, uint64_t> by_status;
+            std::map<std::string, uint64_t> by_type;
+            uint64_t page_no_mismatch = 0;
+            uint64_t space_id_mismatch = 0;
+            uint64_t max_lsn = 0;
+            uint64_t scanned = 0;
+            bool have_space_id = false;
+            uint32_t space_id = 0;
+
+            auto started = std::chrono::steady_clock::now();
+            filesystem_->read_file_chunks(
+                resolved_path, first_page * page_size, (last_page - first_page + 1) * page_size,
+                [&](const char *chunk, size_t size, size_t offset)
+                {
+                    const unsigned char *data = reinterpret_cast<const unsigned char *>(chunk);
+                    for (size_t pos = 0; pos + page_size <= size; pos += page_size)
+                    {
+                        uint64_t page_no = (offset + pos) / page_size;
+                        innodb::PageCheck check = innodb::check_page(data + pos, page_size, compressed);
+                        scanned++;
+                        by_status[check.status]++;
+
+                        bool damaged = check.status == innodb::PageStatus::CHECKSUM_MISMATCH ||
+                                       check.status == innodb::PageStatus::LSN_MISMATCH;
+                        if (check.status != innodb::PageStatus::EMPTY)
+                        {
+                            by_type[innodb::page_type_name(check.header.type)]++;
+                            max_lsn = std::max(max_lsn, check.header.lsn);
+                            if (check.header.page_no != page_no)
+                            {
+                                page_no_mismatch++;
+                                damaged = true;
+                            }
+                            if (!have_space_id)
+                            {
+                                space_id = check.header.space_id;
+                                have_space_id = true;
+                            }
+                            else if (check.header.space_id != space_id)
+                            {
+                                space_id_mismatch++;
+                            }
+                        }
+
+                        if (damaged || verbose)
+                        {
+                            *output_ << "page " << page_no
+                                     << "  no=" << check.header.page_no
+                                     << "  space=" << check.header.space_id
+                                     << "  type=" << innodb::page_type_name(check.header.type)
+                                     << "  lsn=" << check.header.lsn
+                                     << "  checksum=0x" << std::hex << check.header.checksum;
+                            if (check.calculated != 0)
+                            {
+                                *output_ << "/0x" << check.calculated;
+                            }
+                            *output_ << std::dec << "  " << innodb::page_status_name(check.status);
+                            if (check.header.page_no != page_no && check.status != innodb::PageStatus::EMPTY)
+                            {
+                                *output_ << ", PAGE NUMBER MISMATCH";
+                            }
+                            *output_ << "\n";
+                        }
+                    }
+                    return true;
+                },
+                BATCH_PAGES * page_size);
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+            std::ostringstream result;
+            result << "File: " << filename << "\n"
+                   << "Page size: " << page_size << (compressed ? " (compressed)" : "") << "\n"
+                   << "Checksum: crc32c (" << crc32c_implementation() << ")\n"
+                   << "Pages scanned: " << scanned << " (" << first_page << "-" << last_page
+                   << " of " << total_pages << ")\n";
+            if (have_space_id)
+            {
+                result << "Space ID: " << space_id << "\n";
+            }
+            result << "Max LSN: " << max_lsn << "\n\nStatus:\n";
+            for (const auto &entry : by_status)
+            {
+                result << "  " << std::left << std::setw(22) << innodb::page_status_name(entry.first)
+                       << std::right << entry.second << "\n";
+            }
+            if (page_no_mismatch > 0)
+            {
+                result << "  " << std::left << std::setw(22) << "PAGE NUMBER MISMATCH" << std::right << page_no_mismatch << "\n";
+            }
+            if (space_id_mismatch > 0)
+            {
+                result << "  " << std::left << std::setw(22) << "SPACE ID MISMATCH" << std::right << space_id_mismatch << "\n";
+            }
+
+            std::vector<std::pair<std::string, uint64_t>> types(by_type.begin(), by_type.end());
+            std::sort(types.begin(), types.end(), [](const auto &a, const auto &b)
+                      { return a.second > b.second; });
+            result << "\nPage types:\n";
+            for (const auto &entry : types)
+            {
+                result << "  " << std::left << std::setw(22) << entry.first << std::right << entry.second << "\n";
+            }
+            result << "\nElapsed: " << std::fixed << std::setprecision(2) << elapsed << " s ("
+                   << std::setprecision(1) << (elapsed > 0 ? scanned * page_size / elapsed / (1024 * 1024) : 0.0)
+                   << " MB/s)";
+            return CommandResult(true, result.str());
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::cmd_redoscan(const std::vector<std::string> &args)
+    {
+        const std::string usage = "Usage: redoscan [-j N] <redo directory | #ib_redoN>";
+        static constexpr size_t SCAN_CHUNK_SIZE = 4 * 1024 * 1024; // Sequential read size per request
+        static constexpr size_t SCAN_READAHEAD = 2;              // Chunks prefetched ahead of the parser
+
+        std::string target;
+        size_t threads = 0;
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            if (args[i] == "-j" && i + 1 < args.size())
+            {
+                try
+                {
+                    threads = std::stoul(args[++i]);
+                }
+                catch (const std::exception &)
+                {
+                    return CommandResult(false, "Invalid value for -j: " + args[i]);
+                }
+            }
+            else if (args[i][0] != '-')
+            {
+                target = args[i];
+            }
+        }
+        if (target.empty())
+        {
+            return CommandResult(false, usage);
+        }
+
+        try
+        {
+            std::string resolved_path = filesystem_->resolve_path(target);
+            if (!filesystem_->exists(resolved_path))
+            {
+                return CommandResult(false, "File or directory does not exist: " + target);
+            }
+
+            auto is_redo_name = [](const std::string &name)
+            {
+                return name.compare(0, 8, "#ib_redo") == 0 && name.find("_tmp") == std::string::npos;
+            };
+
+            // A directory is scanned for #ib_redo*, a single file is expanded to the slots in use
+            std::string directory;
+            std::vector<std::string> names;
+            if (filesystem_->is_directory(resolved_path))
+            {
+                directory = resolved_path;
+                for (const auto &entry : filesystem_->list_directory(resolved_path))
+                {
+                    if (entry.type == FileType::REGULAR_FILE && is_redo_name(entry.name))
+                    {
+                        names.push_back(entry.name);
+                    }
+                }
+            }
+            else
+            {
+                size_t slash = resolved_path.find_last_of('/');
+                directory = slash == 0 ? "/" : resolved_path.substr(0, slash);
+                std::string name = resolved_path.substr(slash + 1);
+                SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
+                if (spdb_sdk_fs != nullptr && is_redo_name(name))
+                {
+                    names = spdb_sdk_fs->get_redo_log_files(resolved_path);
+                }
+                if (std::find(names.begin(), names.end(), name) == names.end())
+                {
+                    names.push_back(name);
+                }
+            }
+            if (names.empty())
+            {
+                return CommandResult(false, "No redo log files found in " + target);
+            }
+
+            std::vector<innodb::RedoFileScan> scans(names.size());
+            for (size_t i = 0; i < names.size(); ++i)
+            {
+                scans[i].name = names[i];
+            }
+
+            // Files are independent, each worker scans whole files sequentially
+            if (threads == 0)
+            {
+                threads = FileSystemInterface::DEFAULT_WALK_THREADS;
+            }
+            threads = std::min(threads, scans.size());
+            std::atomic<size_t> next{0};
+            auto scan_files = [&]()
+            {
+                for (size_t i = next++; i < scans.size(); i = next++)
+                {
+                    innodb::RedoFileScan &scan = scans[i];
+                    try
+                    {
+                        innodb::RedoFileScanner scanner(scan);
+                        filesystem_->read_file_chunks(
+                            directory == "/" ? "/" + scan.name : directory + "/" + scan.name, 0, 0,
+                            [&](const char *chunk, size_t size, size_t offset)
+                            {
+                                scanner.consume(reinterpret_cast<const unsigned char *>(chunk), size, offset);
+                                return true;
+                            },
+                            SCAN_CHUNK_SIZE, SCAN_READAHEAD);
+                        scanner.finish();
+                    }
+                    catch (const std::exception &e)
+                    {
+                        scan.error = e.what();
+                    }
+                }
+            };
+
+            auto started = std::chrono::steady_clock::now();
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < threads; ++t)
+            {
+                workers.emplace_back(scan_files);
+            }
+            scan_files();
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+            std::sort(scans.begin(), scans.end(), [](const innodb::RedoFileScan &a, const innodb::RedoFileScan &b)
+                      { return a.start_lsn != b.start_lsn ? a.start_lsn < b.start_lsn : a.name < b.name; });
+
+            std::ostringstream result;
+            uint64_t total_bytes = 0;
+            uint64_t min_lsn = UINT64_MAX;
+            uint64_t max_lsn = 0;
+            uint64_t checkpoint_lsn = 0;
+            std::string checkpoint_file;
+            size_t failed = 0;
+            std::vector<const innodb::RedoFileScan *> chain;
+
+            for (const auto &scan : scans)
+            {
+                total_bytes += scan.file_size;
+                result << scan.name << ": ";
+                if (!scan.error.empty())
+                {
+                    result << "ERROR " << scan.error << "\n";
+                    failed++;
+                    continue;
+                }
+                if (!scan.header_valid)
+                {
+                    result << "INVALID HEADER, size " << scan.file_size << "\n";
+                    continue;
+                }
+                result << "lsn " << scan.start_lsn << "-" << scan.recovery_end_lsn
+                       << "  size " << scan.file_size
+                       << "  blocks " << scan.valid_blocks << "/" << scan.data_blocks;
+                for (int c = 0; c < 2; ++c)
+                {
+                    if (scan.checkpoint_lsn[c] != 0)
+                    {
+                        result << "  checkpoint" << (c + 1) << " " << scan.checkpoint_lsn[c];
+                        if (scan.checkpoint_lsn[c] > checkpoint_lsn)
+                        {
+                            checkpoint_lsn = scan.checkpoint_lsn[c];
+                            checkpoint_file = scan.name;
+                        }
+                    }
+                }
+                if (scan.torn_blocks + scan.gap_blocks > 0)
+                {
+                    result << "  TORN " << scan.torn_blocks << ", OUT OF SEQUENCE " << scan.gap_blocks
+                           << " (first at offset " << scan.first_hole_offset
+                           << ", valid data continues to lsn " << scan.last_valid_lsn << ")";
+                }
+                result << "\n";
+
+                min_lsn = std::min(min_lsn, scan.start_lsn);
+                max_lsn = std::max(max_lsn, scan.recovery_end_lsn);
+                chain.push_back(&scan);
+            }
+
+            // Consecutive files must continue exactly where the previous one's capacity ends
+            std::vector<std::string> problems;
+            for (size_t i = 1; i < chain.size(); ++i)
+            {
+                const innodb::RedoFileScan &prev = *chain[i - 1];
+                const innodb::RedoFileScan &cur = *chain[i];
+                if (cur.start_lsn != prev.capacity_end_lsn())
+                {
+                    problems.push_back("LSN discontinuity between " + prev.name + " and " + cur.name +
+                                       ": expected start " + std::to_string(prev.capacity_end_lsn()) +
+                                       ", found " + std::to_string(cur.start_lsn));
+                }
+                else if (prev.recovery_end_lsn < prev.capacity_end_lsn() && cur.recovery_end_lsn > cur.start_lsn)
+                {
+                    problems.push_back(prev.name + " ends at lsn " + std::to_string(prev.recovery_end_lsn) +
+                                       " before its capacity but " + cur.name + " contains data");
+                }
+            }
+            for (const auto *scan : chain)
+            {
+                if (scan->torn_blocks + scan->gap_blocks > 0)
+                {
+                    problems.push_back(scan->name + " has a hole at offset " + std::to_string(scan->first_hole_offset) +
+                                       ", recovery stops at lsn " + std::to_string(scan->recovery_end_lsn));
+                }
+            }
+            if (checkpoint_lsn != 0 && !chain.empty() && (checkpoint_lsn < min_lsn || checkpoint_lsn > max_lsn))
+            {
+                problems.push_back("Checkpoint lsn " + std::to_string(checkpoint_lsn) + " is outside the scanned range");
+            }
+
+            result << "\nFiles: " << scans.size() << " (" << chain.size() << " valid)\n";
+            if (!chain.empty())
+            {
+                result << "LSN range: " << min_lsn << "-" << max_lsn << "\n";
+            }
+            if (checkpoint_lsn != 0)
+            {
+                result << "Checkpoint: " << checkpoint_lsn << " (" << checkpoint_file << ")\n";
+            }
+            else
+            {
+                result << "Checkpoint: none found\n";
+            }
+            result << "Checksum: crc32c (" << crc32c_implementation() << ")\n";
+            if (problems.empty())
+            {
+                result << "Continuity: ok\n";
+            }
+            else
+            {
+                result << "Continuity: " << problems.size() << " problem(s)\n";
+                for (const auto &problem : problems)
+                {
+                    result << "  " << problem << "\n";
+                }
+            }
+            result << "\nElapsed: " << std::fixed << std::setprecision(2) << elapsed << " s ("
+                   << std::setprecision(1) << (elapsed > 0 ? total_bytes / elapsed / (1024 * 1024) : 0.0)
+                   << " MB/s, " << threads << " threads)";
+            return CommandResult(failed == 0, result.str());
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::cmd_sum(const std::vector<std::string> &args)
+    {
+        const std::string usage = "Usage: sum [-chunk N[k|M]] [-j N] [-v] <filename...>";
+
+        std::vector<std::string> files;
+        size_t chunk_size = FileSystemInterface::DEFAULT_CHECKSUM_CHUNK;
+        size_t depth = 0;
+        bool verbose = false;
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            if (args[i] == "-chunk" && i + 1 < args.size())
+            {
+                if (!parse_size(args[++i], chunk_size) || chunk_size == 0)
+                {
+                    return CommandResult(false, "Invalid value for -chunk: " + args[i]);
+                }
+            }
+            else if (args[i] == "-j" && i + 1 < args.size())
+            {
+                try
+                {
+                    depth = std::stoul(args[++i]);
+                }
+                catch (const std::exception &)
+                {
+                    return CommandResult(false, "Invalid value for -j: " + args[i]);
+                }
+            }
+            else if (args[i] == "-v")
+            {
+                verbose = true;
+            }
+            else if (args[i][0] != '-')
+            {
+                files.push_back(args[i]);
+            }
+        }
+        if (files.empty())
+        {
+            return CommandResult(false, usage);
+        }
+
+        // One file at a time, each file already keeps depth chunks in flight
+        std::ostringstream result;
+        bool ok = true;
+        uint64_t total_bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto &filename : expand_paths(files))
+        {
+            try
+            {
+                std::string resolved_path = filesystem_->resolve_path(filename);
+                if (!filesystem_->exists(resolved_path))
+                {
+                    result << "File does not exist: " << filename << "\n";
+                    ok = false;
+                    continue;
+                }
+                if (filesystem_->is_directory(resolved_path))
+                {
+                    result << filename << " is a directory, cannot checksum\n";
+                    ok = false;
+                    continue;
+                }
+
+                FileChecksum checksum = filesystem_->checksum_file(resolved_path, chunk_size, depth);
+                total_bytes += checksum.size;
+                result << std::hex << std::setw(8) << std::setfill('0') << checksum.crc << std::dec << std::setfill(' ')
+                       << "  " << checksum.size << "  " << filename << "\n";
+                if (verbose)
+                {
+                    for (size_t k = 0; k < checksum.chunks.size(); ++k)
+                    {
+                        result << "  chunk " << k << " @" << k * checksum.chunk_size << ": " << std::hex
+                               << std::setw(8) << std::setfill('0') << checksum.chunks[k] << std::dec
+                               << std::setfill(' ') << "\n";
+                    }
+                }
+            }
+            catch (const std::exception &e)
+            {
+                result << "Error: " << e.what() << "\n";
+                ok = false;
+            }
+        }
+
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result << "\nChecksum: crc32c (" << crc32c_implementation() << ")\n"
+               << "Elapsed: " << std::fixed << std::setprecision(2) << elapsed << " s (" << std::setprecision(1)
+               << (elapsed > 0 ? total_bytes / elapsed / (1024 * 1024) : 0.0) << " MB/s)";
+        return CommandResult(ok, result.str());
+    }
+
+    CommandResult FileClient::cmd_cmp(const std::vector<std::string> &args)
+    {
+        const std::string usage = "Usage: cmp [-chunk N[k|M]] [-j N] [--page-size N] <fileA> <fileB>"
+                                  " (local:<path> names a local file)";
+
+        std::vector<std::string> files;
+        size_t chunk_size = FileSystemInterface::DEFAULT_CHECKSUM_CHUNK;
+        size_t depth = 0;
+        size_t page_size = innodb::UNIV_PAGE_SIZE_DEF;
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            if (args[i] == "-chunk" && i + 1 < args.size())
+            {
+                if (!parse_size(args[++i], chunk_size) || chunk_size == 0)
+                {
+                    return CommandResult(false, "Invalid value for -chunk: " + args[i]);
+                }
+            }
+            else if ((args[i] == "-j" || args[i] == "--page-size") && i + 1 < args.size())
+            {
+                try
+                {
+                    size_t value = std::stoul(args[i + 1]);
+                    (args[i] == "-j" ? depth : page_size) = value;
+                    i++; // Skip next parameter
+                }
+                catch (const std::exception &)
+                {
+                    return CommandResult(false, "Invalid value for " + args[i] + ": " + args[i + 1]);
+                }
+            }
+            else if (args[i][0] != '-')
+            {
+                files.push_back(args[i]);
+            }
+        }
+        if (files.size() != 2 || page_size == 0)
+        {
+            return CommandResult(false, usage);
+        }
+
+        try
+        {
+            // "local:<path>" operands are read from the local file system, the others through the SDK
+            std::string paths[2];
+            bool local[2];
+            for (int f = 0; f < 2; ++f)
+            {
+                local[f] = local_file::strip_prefix(files[f], paths[f]);
+                bool exists = false;
+                bool directory = false;
+                if (local[f])
+                {
+                    FileType type;
+                    exists = local_file::get_file_type(paths[f], type);
+                    directory = exists && type == FileType::DIRECTORY;
+                }
+                else
+                {
+                    paths[f] = filesystem_->resolve_path(files[f]);
+                    exists = filesystem_->exists(paths[f]);
+                    directory = exists && filesystem_->is_directory(paths[f]);
+                }
+                if (!exists)
+                {
+                    return CommandResult(false, "File does not exist: " + files[f]);
+                }
+                if (directory)
+                {
+                    return CommandResult(false, files[f] + " is a directory, cannot compare");
+                }
+            }
+            auto checksum = [&](int f)
+            {
+                return local[f] ? local_file::checksum(paths[f], chunk_size, depth)
+                                : filesystem_->checksum_file(paths[f], chunk_size, depth);
+            };
+            auto read_at = [&](int f, uint64_t offset, size_t length)
+            {
+                return local[f] ? local_file::read_at(paths[f], offset, length)
+                                : filesystem_->read_file_content_at_offset(paths[f], offset, length);
+            };
+
+            // Both sides are checksummed at once, so a local backup is read while the SDK copy is
+            auto start = std::chrono::steady_clock::now();
+            auto first = std::async(std::launch::async, [&]
+                                    { return checksum(0); });
+            FileChecksum b = checksum(1);
+            FileChecksum a = first.get();
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            const size_t common = std::min(a.chunks.size(), b.chunks.size());
+            size_t differing = 0;
+            size_t first_chunk = common;
+            for (size_t k = 0; k < common; ++k)
+            {
+                if (a.chunks[k] != b.chunks[k])
+                {
+                    differing++;
+                    first_chunk = std::min(first_chunk, k);
+                }
+            }
+
+            std::ostringstream result;
+            result << files[0] << " " << files[1];
+            bool same = differing == 0 && a.size == b.size;
+            if (same)
+            {
+                result << " are identical: crc32c " << std::hex << std::setw(8) << std::setfill('0') << a.crc
+                       << std::dec << std::setfill(' ') << ", " << a.size << " bytes";
+            }
+            else
+            {
+                // Locate the byte inside the first differing chunk, a short last chunk only differs by length
+                uint64_t diff_offset = std::min(a.size, b.size);
+                if (first_chunk < common)
+                {
+                    uint64_t chunk_offset = first_chunk * a.chunk_size;
+                    std::string left = read_at(0, chunk_offset, a.chunk_size);
+                    std::string right = read_at(1, chunk_offset, b.chunk_size);
+                    size_t length = std::min(left.size(), right.size());
+                    auto mismatch = std::mismatch(left.begin(), left.begin() + length, right.begin());
+                    diff_offset = chunk_offset + (mismatch.first - left.begin());
+                }
+                if (diff_offset < std::min(a.size, b.size))
+                {
+                    result << " differ: offset " << diff_offset << ", page " << diff_offset / page_size << ", chunk "
+                           << diff_offset / a.chunk_size << " (" << differing << " of " << common
+                           << " chunks differ)";
+                }
+                else
+                {
+                    result << " differ: EOF on " << (a.size < b.size ? files[0] : files[1]) << " after byte "
+                           << diff_offset;
+                }
+                if (a.size != b.size)
+                {
+                    result << "\nSizes: " << a.size << " vs " << b.size << " bytes";
+                }
+            }
+            result << "\nElapsed: " << std::fixed << std::setprecision(2) << elapsed << " s (" << std::setprecision(1)
+                   << (elapsed > 0 ? (a.size + b.size) / elapsed / (1024 * 1024) : 0.0) << " MB/s)";
+            return CommandResult(same, result.str());
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::cmd_meta(const std::vector<std::string> &args)
+    {
+        const std::string usage = "Usage: meta [-r] [--format text|json|csv] <filename|dir>...";
+
+        std::vector<std::string> targets;
+        bool recursive = false;
+        std::string format = "text";
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            if (args[i] == "-r")
+            {
+                recursive = true;
+            }
+            else if (args[i] == "--format" && i + 1 < args.size())
+            {
+                format = args[++i];
+                if (format != "text" && format != "json" && format != "csv")
+                {
+                    return CommandResult(false, "Unsupported --format " + format + ", use text, json or csv");
+                }
+            }
+            else if (args[i][0] != '-')
+            {
+                targets.push_back(args[i]);
+            }
+        }
+        if (targets.empty())
+        {
+            return CommandResult(false, usage);
+        }
+
+        // Directories are expanded to the files that carry metadata, the walk's stats are cached
+        std::vector<std::string> paths;
+        for (const auto &target : expand_paths(targets))
+        {
+            if (recursive)
+            {
+                try
+                {
+                    std::string resolved_path = filesystem_->resolve_path(target);
+                    if (filesystem_->is_directory(resolved_path))
+                    {
+                        FindQuery query;
+                        query.type = FileType::REGULAR_FILE;
+                        std::string prefix = target.back() == '/' ? target : target + "/";
+                        for (const auto &entry : filesystem_->find(resolved_path, query))
+                        {
+                            if (FileSystemInterface::metadata_kind(entry.path) != MetadataKind::NONE)
+                            {
+                                paths.push_back(prefix + entry.path);
+                            }
+                        }
+                        continue;
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    // Reported by the per-file lookup below
+                }
+            }
+            paths.push_back(target);
+        }
+
+        if (format == "text")
+        {
+            if (paths.empty())
+            {
+                return CommandResult(true, "No tablespace or redo log files found");
+            }
+            return merge_results(run_per_path(paths, [this](const std::string &path)
+                                              { return meta_one(path); }),
+                                 "\n\n");
+        }
+
+        bool csv = format == "csv";
+        std::vector<CommandResult> records;
+        if (!paths.empty())
+        {
+            records = run_per_path(paths, [this, csv](const std::string &path)
+                                   { return meta_record(path, csv); });
+        }
+        std::string body = csv ? "path,kind,uuid,space_id,shard_count,block_count,version,version_uuid,"
+                                 "start_lsn,end_lsn,version_space_id,permission,error"
+                               : "[";
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            body += csv ? "\n" : (i == 0 ? "\n" : ",\n");
+            body += records[i].message;
+        }
+        if (!csv)
+        {
+            body += records.empty() ? "]" : "\n]";
+        }
+        return CommandResult(true, body);
+    }
+
+    CommandResult FileClient::meta_one(const std::string &filename)
+    {
+        try
+        {
+            std::string resolved_path = filesystem_->resolve_path(filename);
+
+            // 检查文件是否支持元数据
+            if (!filesystem_->has_file_metadata(resolved_path))
+            {
+                if (!filesystem_->exists(resolved_path))
+                {
+                    return CommandResult(false, "File does not exist: " + filename);
+                }
+                else if (filesystem_->is_directory(resolved_path))
+                {
+                    return CommandResult(false, filename + " is a directory, cannot get metadata");
+                }
+                else
+                {
+                    return CommandResult(false, "Unsupported file type. Only redolog and IBD files have metadata.\n"
+                                               "Supported: *.ibd files, #ib_redo* files");
+                }
+            }
+
+            // 获取文件元数据
+            std::string metadata = filesystem_->get_file_metadata(resolved_path);
+            return CommandResult(true, metadata);
+        }
+        catch (const std::exception &e)
+        {
+            return CommandResult(false, "Error: " + std::string(e.what()));
+        }
+    }
+
+    CommandResult FileClient::meta_record(const std::string &filename, bool csv)
+    {
+        std::shared_ptr<const FileMetadata> meta;
+        std::string error;
+        try
+        {
+            meta = filesystem_->read_file_metadata(filesystem_->resolve_path(filename));
+        }
+        catch (const std::exception &e)
+        {
+            error = e.what();
+            std::replace(error.begin(), error.end(), '\n', ' ');
+        }
+
+        std::ostringstream record;
+        if (csv)
+        {
+            const std::string path = csv_field(filename);
+            if (!meta)
+            {
+                record << path << ",,,,,,,,,,,," << csv_field(error);
+            }
+            else if (meta->kind == MetadataKind::REDO)
+            {
+                record << path << ",redo," << csv_field(meta->cluster_uuid) << ",,,,,,,,,,";
+            }
+            else
+            {
+                // One row per version so LSN ranges can be audited with plain text tools
+                std::string common = path + ",ibd," + csv_field(meta->uuid) + "," + std::to_string(meta->space_id) +
+                                     "," + std::to_string(meta->shard_count) + "," + std::to_string(meta->block_count);
+                if (meta->versions.empty())
+                {
+                    record << common << ",,,,,,,";
+                }
+                for (size_t i = 0; i < meta->versions.size(); ++i)
+                {
+                    const auto &version = meta->versions[i];
+                    record << (i == 0 ? "" : "\n") << common << "," << i + 1 << "," << csv_field(version.uuid) << ","
+                           << version.start_lsn << "," << version.end_lsn << "," << version.space_id << ","
+                           << (version.read_only ? "READ_ONLY" : "READ_WRITE") << ",";
+                }
+            }
+            return CommandResult(meta != nullptr, record.str());
+        }
+
+        record << "{\"path\":" << json_quote(filename);
+        if (!meta)
+        {
+            record << ",\"error\":" << json_quote(error);
+        }
+        else if (meta->kind == MetadataKind::REDO)
+        {
+            record << ",\"kind\":\"redo\",\"cluster_id\":" << meta->cluster_id
+                   << ",\"cluster_uuid\":" << json_quote(meta->cluster_uuid) << ",\"chunk_size\":" << meta->chunk_size
+                   << ",\"chunk_count\":" << meta->chunk_count << ",\"slots\":[";
+            for (size_t i = 0; i < meta->slots.size(); ++i)
+            {
+                const auto &slot = meta->slots[i];
+                record << (i == 0 ? "" : ",") << "{\"id\":" << slot.id
+                       << ",\"in_use\":" << (slot.in_use ? "true" : "false")
+                       << ",\"file_name\":" << json_quote(slot.file_name) << "}";
+            }
+            record << "]";
+        }
+        else
+        {
+            record << ",\"kind\":\"ibd\",\"uuid\":" << json_quote(meta->uuid) << ",\"space_id\":" << meta->space_id
+                   << ",\"shard_count\":" << meta->shard_count << ",\"block_count\":" << meta->block_count
+                   << ",\"versions\":[";
+            for (size_t i = 0; i < meta->versions.size(); ++i)
+            {
+                const auto &version = meta->versions[i];
+                record << (i == 0 ? "" : ",") << "{\"uuid\":" << json_quote(version.uuid)
+                       << ",\"start_lsn\":" << version.start_lsn << ",\"end_lsn\":" << version.end_lsn
+                       << ",\"space_id\":" << version.space_id << ",\"permission\":\""
+                       << (version.read_only ? "READ_ONLY" : "READ_WRITE") << "\"}";
+            }
+            record << "]";
+        }
+        record << "}";
+        return CommandResult(meta != nullptr, record.str());
+    }
+
+    CommandResult FileClient::cmd_cache(const std::vector<std::string> &args)
+    {
+        SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
+        if (!spdb_sdk_fs)
+        {
+            return CommandResult(false, "Metadata cache is not available for this file system");
+        }
+        StatCache &cache = spdb_sdk_fs->stat_cache();
+        MetadataCache &meta_cache = spdb_sdk_fs->metadata_cache();
+
+        if (!args.empty() && args[0] == "clear")
+        {
+            cache.clear();
+            meta_cache.clear();
+            spdb_sdk_fs->fd_pool().clear();
+            return CommandResult(true, "Metadata cache and descriptor pool cleared");
+        }
+        if (!args.empty() && args[0] == "ttl")
+        {
+            if (args.size() < 2)
+            {
+                return CommandResult(true, "TTL: " + std::to_string(cache.ttl().count()) + " ms");
+            }
+            try
+            {
+                cache.set_ttl(std::chrono::milliseconds(std::stoll(args[1])));
+                meta_cache.set_ttl(cache.ttl());
+            }
+            catch (const std::exception &)
+            {
+                return CommandResult(false, "Invalid ttl value: " + args[1]);
+            }
+            return CommandResult(true, "TTL set to " + std::to_string(cache.ttl().count()) + " ms");
+        }
+        if (!args.empty())
+        {
+            return CommandResult(false, "Usage: cache [clear | ttl <ms>]");
+        }
+
+        StatCache::Counters counters = cache.counters();
+        uint64_t lookups = counters.hits + counters.misses;
+        std::ostringstream result;
+        result << "TTL: " << cache.ttl().count() << " ms\n"
+               << "Entries: " << counters.entries << "\n"
+               << "Hits: " << counters.hits << "\n"
+               << "Misses: " << counters.misses << "\n"
+               << "Hit rate: " << std::fixed << std::setprecision(1)
+               << (lookups ? counters.hits * 100.0 / lookups : 0.0) << "%\n"
+               << "Invalidations: " << counters.invalidations << "\n"
+               << "Evictions: " << counters.evictions << "\n";
+
+        MetadataCache::Counters meta_counters = meta_cache.counters();
+        result << "\nSDK metadata:\n"
+               << "Entries: " << meta_counters.entries << "\n"
+               << "Hits: " << meta_counters.hits << "\n"
+               << "Misses: " << meta_counters.misses << "\n";
+
+        FdPool::Counters fd_counters = spdb_sdk_fs->fd_pool().counters();
+        result << "\nDescriptor pool:\n"
+               << "Open descriptors: " << fd_counters.open_fds << "\n"
+               << "Reused: " << fd_counters.hits << "\n"
+               << "Opened: " << fd_counters.opens << "\n"
+               << "Evicted: " << fd_counters.evictions;
+        return CommandResult(true, result.str());
+    }
+
+    CommandResult FileClient::cmd_iostat(const std::vector<std::string> &args)
+    {
+        SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
+        if (!spdb_sdk_fs)
+        {
+            return CommandResult(false, "I/O statistics are not available for this file system");
+        }
+        IoStats &stats = spdb_sdk_fs->io_stats();
+
+        if (!args.empty() && args[0] == "reset")
+        {
+            stats.reset();
+            return CommandResult(true, "I/O statistics reset");
+        }
+        if (!args.empty())
+        {
+            return CommandResult(false, "Usage: iostat [reset]");
+        }
+
+        std::ostringstream result;
+        result << std::left << std::setw(10) << "call" << std::right
+               << std::setw(12) << "count" << std::setw(12) << "avg(us)"
+               << std::setw(10) << "p50" << std::setw(10) << "p99"
+               << std::setw(10) << "p99.9" << std::setw(10) << "max";
+        for (size_t i = 0; i < static_cast<size_t>(IoOp::COUNT); ++i)
+        {
+            IoOp op = static_cast<IoOp>(i);
+            LatencyHistogram::Snapshot snap = stats.snapshot(op);
+            result << "\n" << std::left << std::setw(10) << IoStats::op_name(op) << std::right
+                   << std::setw(12) << snap.count
+                   << std::setw(12) << std::fixed << std::setprecision(1) << snap.average()
+                   << std::setw(10) << snap.percentile(0.5)
+                   << std::setw(10) << snap.percentile(0.99)
+                   << std::setw(10) << snap.percentile(0.999)
+                   << std::setw(10) << snap.max_us;
+        }
+        return CommandResult(true, result.str());
+    }
+
+    CommandResult FileClient::cmd_timing(const std::vector<std::string> &args)
+    {
+        if (args.empty())
+        {
+            return CommandResult(true, std::string("timing is ") + (timing_.load() ? "on" : "off"));
+        }
+        if (args.size() != 1 || (args[0] != "on" && args[0] != "off"))
+        {
+            return CommandResult(false, "Usage: timing [on|off]");
+        }
+        timing_.store(args[0] == "on");
+        return CommandResult(true, "timing " + args[0]);
+    }
+
+    CommandResult FileClient::cmd_stats(const std::vector<std::string> &args)
+    {
+        if (!args.empty() && args[0] == "reset")
+        {
+            instrumented_->reset();
+            commands_run_.store(0);
+            command_nanos_.store(0);
+            return CommandResult(true, "Statistics reset");
+        }
+        if (!args.empty())
+        {
+            return CommandResult(false, "Usage: stats [reset]");
+        }
+
+        std::ostringstream result;
+        result << std::fixed << std::setprecision(3)
+               << "commands: " << commands_run_.load() << ", wall time " << command_nanos_.load() / 1e6 << " ms\n"
+               << std::left << std::setw(10) << "call" << std::right
+               << std::setw(12) << "count" << std::setw(14) << "total(ms)"
+               << std::setw(12) << "avg(us)" << std::setw(16) << "bytes";
+        InstrumentedFileSystem::Snapshot snap = instrumented_->snapshot();
+        for (size_t i = 0; i < snap.size(); ++i)
+        {
+            const FsCallTotals &totals = snap[i];
+            result << "\n" << std::left << std::setw(10) << InstrumentedFileSystem::call_name(static_cast<FsCall>(i))
+                   << std::right << std::setw(12) << totals.calls
+                   << std::setw(14) << std::setprecision(3) << totals.nanos / 1e6
+                   << std::setw(12) << std::setprecision(1) << (totals.calls ? totals.nanos / 1e3 / totals.calls : 0.0)
+                   << std::setw(16) << totals.bytes;
+        }
+        return CommandResult(true, result.str());
+    }
+
+    std::vector<uint64_t> FileClient::sdk_counters()
+    {
+        std::vector<uint64_t> counters;
+        SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
+        if (!spdb_sdk_fs)
+        {
+            return counters;
+        }
+        IoStats &stats = spdb_sdk_fs->io_stats();
+        for (size_t i = 0; i < static_cast<size_t>(IoOp::COUNT); ++i)
+        {
+            counters.push_back(stats.snapshot(static_cast<IoOp>(i)).count);
+        }
+        counters.push_back(stats.bytes(IoOp::READ));
+        return counters;
+    }
+
+    std::string FileClient::format_timing(uint64_t nanos, const InstrumentedFileSystem::Snapshot &before,
+                                          const InstrumentedFileSystem::Snapshot &after,
+                                          const std::vector<uint64_t> &sdk_before)
+    {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3) << "[timing] " << nanos / 1e6 << " ms";
+
+        const char *separator = ", calls: ";
+        for (size_t i = 0; i < after.size(); ++i)
+        {
+            uint64_t calls = after[i].calls - before[i].calls;
+            if (calls == 0)
+            {
+                continue;
+            }
+            line << separator << InstrumentedFileSystem::call_name(static_cast<FsCall>(i)) << " " << calls
+                 << " (" << (after[i].nanos - before[i].nanos) / 1e6 << " ms";
+            if (after[i].bytes != before[i].bytes)
+            {
+                line << ", " << after[i].bytes - before[i].bytes << " bytes";
+            }
+            line << ")";
+            separator = " ";
+        }
+
+        std::vector<uint64_t> sdk_after = sdk_counters();
+        if (!sdk_before.empty() && sdk_after.size() == sdk_before.size())
+        {
+            line << ", sdk:";
+            for (size_t i = 0; i < static_cast<size_t>(IoOp::COUNT); ++i)
+            {
+                line << " " << IoStats::op_name(static_cast<IoOp>(i)) << " " << sdk_after[i] - sdk_before[i];
+            }
+            line << " (" << sdk_after.back() - sdk_before.back() << " bytes read)";
+        }
+        return line.str();
+    }
+
+    CommandResult FileClient::cmd_help(const std::vector<std::string> &)
+    {
+        std::ostringstream help;
+        help << "File Client Tool - Available Commands:\n\n"
+             << "Directory Operations:\n"
+             << "  ls [path...]             List directory contents\n"
+             << "  ls -l [path...]          List detailed directory contents (permissions, size, time)\n"
+             << "  ll                       List directory contents\n"
+             << "  cd [path]                Change directory\n"
+             << "  du [-h] [--max-depth N] [-j N] [path]\n"
+             << "                           Show directory size, walking the tree with N threads\n"
+             << "  find [path] [-name G] [-type f|d] [-size [+|-]N[k|M|G]] [-maxdepth N] [-j N]\n"
+             << "                           Search the tree, stat'ing entries only when needed;\n"
+             << "                           G may be quoted as in a shell (-name '*.txt')\n"
+             << "  pwd                      Show current directory\n\n"
+             << "File Information:\n"
+             << "  file <filename...>       Show file type\n"
+             << "  meta <filename...>       Show file meta infomation (only redo, ibd)\n"
+             << "    meta -r [--format text|json|csv] <dir...>\n"
+             << "                           Fetch the metadata of every tablespace and redo file below dir\n"
+             << "  stat <filename...>       Show detailed file information\n"
+             << "                           ls/file/meta/stat accept several paths and globs (*.ibd),\n"
+             << "                           processed concurrently and printed in argument order\n"
+             << "  pages [--range a-b] [--page-size N] [-v] <file.ibd>\n"
+             << "                           Verify InnoDB page checksums and summarize page headers\n"
+             << "  redoscan [-j N] <dir|#ib_redoN>\n"
+             << "                           Scan redo log files in parallel, report LSN range and holes\n\n"
+             << "File Content:\n"
+             << "  cat <filename>           Display file content\n"
+             << "    cat -offset N -len N <filename>\n"
+             << "  view [-text] [-len N] [-offset N] [-page-size N] <filename>\n"
+             << "                           Page through a file (n/b/o <offset>/pg <N>/q), neighbours are prefetched;\n"
+             << "                           -len is at most 1M per screen\n"
+             << "  hexdump <filename>       Display hexadecimal dump of file\n"
+             << "    hexdump -C <filename>  Canonical hex+ASCII dump\n"
+             << "    hexdump -w N -offset N -len N <filename>\n"
+             << "  dump [-j N] [-f] [-offset N] [-len N] <filename> <local_path>\n"
+             << "                           Copy a file to local disk with N reads in flight (alias copy-out)\n"
+             << "  sum [-chunk N[k|M]] [-j N] [-v] <filename...>\n"
+             << "                           CRC32C of whole files, N chunks read and hashed in parallel\n"
+             << "  cmp [-chunk N[k|M]] [-j N] [--page-size N] <fileA> <fileB>\n"
+             << "                           Compare two files by chunk checksums, report the first differing byte\n"
+             << "    cmp t1.ibd local:/backup/t1.ibd  Compare with a local copy, read with pread\n\n"
+             << "Other:\n"
+             << "  cache [clear|ttl <ms>]   Show or control the metadata cache and descriptor pool\n"
+             << "  iostat [reset]           Show SDK call latency histograms (p50/p99/p99.9/max in us)\n"
+             << "  timing [on|off]          Print wall time, calls and bytes moved after each command\n"
+             << "  stats [reset]            Show cumulative command time and file system call totals\n"
+             << "  help                     Show this help message\n"
+             << "  exit/quit                Exit the program\n\n"
+             << "Note: Access is restricted to the specified root directory";
+
+        return CommandResult(true, help.str());
+    }
+
+    void FileClient::run_interactive()
+    {
+        SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
+        if (spdb_sdk_fs)
+        {
+            std::cerr << "File Client Tool started (Root directory: " << spdb_sdk_fs->get_real_system_path() << ")\n";
+        }
+        else
+        {
+            std::cerr << "File Client Tool started\n";
+        }
+        std::cerr << "Type 'help' for available commands, 'exit' to quit\n\n";
+        std::string input;
+        while (true)
+        {
+            std::cerr << get_prompt(); // 打印提示符
+            if (!std::getline(std::cin, input))
+            {
+                break; // EOF or input error
+            }
+            auto result = execute_command(input);
+            if (result.message == "exit")
+            {
+                break; // Exit command
+            }
+            if (!result.success)
+            {
+                std::cerr << "Error: " << result.message << std::endl;
             }
             if (!result.message.empty())
             {
@@ -633,6 +2285,205 @@ namespace file_client
         std::cerr << "Goodbye!" << std::endl;
     }
 
+    size_t FileClient::run_batch(const std::vector<std::string> &commands)
+    {
+        static const std::unordered_set<std::string> prefetchable = {
+            "ls", "ll", "stat", "file", "meta", "du", "find", "pwd"};
+
+        size_t failed = 0;
+        auto write_result = [&](const CommandResult &result)
+        {
+            if (!result.success)
+            {
+                failed++;
+                *output_ << "Error: ";
+            }
+            if (!result.message.empty())
+            {
+                *output_ << result.message << '\n';
+            }
+        };
+
+        // Prefetched results are printed strictly in submission order
+        std::deque<std::future<CommandResult>> pending;
+        auto drain = [&](size_t keep)
+        {
+            while (pending.size() > keep)
+            {
+                write_result(pending.front().get());
+                pending.pop_front();
+            }
+        };
+
+        for (const auto &command : commands)
+        {
+            std::vector<std::string> tokens = parse_command(command);
+            if (tokens.empty())
+            {
+                continue;
+            }
+            // Counters are diffed per command, so timed batches run strictly in order
+            if (prefetchable.count(tokens[0]) && !timing_.load())
+            {
+                drain(BATCH_PREFETCH_DEPTH - 1);
+                pending.push_back(std::async(std::launch::async, [this, command]()
+                                             { return execute_command(command); }));
+                continue;
+            }
+
+            drain(0);
+            CommandResult result = execute_command(command);
+            if (result.message == "exit")
+            {
+                break;
+            }
+            write_result(result);
+        }
+        drain(0);
+        output_->flush();
+        return failed;
+    }
+
+    std::vector<std::string> FileClient::expand_paths(const std::vector<std::string> &patterns)
+    {
+        std::vector<std::string> paths;
+        for (const auto &pattern : patterns)
+        {
+            size_t slash = pattern.rfind('/');
+            std::string dir = slash == std::string::npos ? "" : pattern.substr(0, slash + 1);
+            std::string base = slash == std::string::npos ? pattern : pattern.substr(slash + 1);
+            if (base.find_first_of("*?[") == std::string::npos)
+            {
+                paths.push_back(pattern);
+                continue;
+            }
+
+            std::vector<std::string> matches;
+            try
+            {
+                std::string resolved_dir = filesystem_->resolve_path(dir.empty() ? "." : dir);
+                for (const auto &entry : filesystem_->list_directory(resolved_dir))
+                {
+                    if (fnmatch(base.c_str(), entry.name.c_str(), FNM_PERIOD) == 0)
+                    {
+                        matches.push_back(dir + entry.name);
+                    }
+                }
+            }
+            catch (const std::exception &)
+            {
+                // Unreadable directory, report the pattern itself
+            }
+
+            if (matches.empty())
+            {
+                paths.push_back(pattern);
+                continue;
+            }
+            std::sort(matches.begin(), matches.end());
+            paths.insert(paths.end(), matches.begin(), matches.end());
+        }
+        return paths;
+    }
+
+    std::vector<CommandResult> FileClient::run_per_path(const std::vector<std::string> &paths,
+                                                        const std::function<CommandResult(const std::string &)> &func)
+    {
+        std::vector<CommandResult> results(paths.size());
+        auto run_one = [&](size_t i)
+        {
+            try
+            {
+                results[i] = func(paths[i]);
+            }
+            catch (const std::exception &e)
+            {
+                results[i] = CommandResult(false, "Error: " + std::string(e.what()));
+            }
+        };
+        if (paths.size() == 1)
+        {
+            run_one(0);
+            return results;
+        }
+
+        // Wait for this command's tasks only, the pool may be shared by prefetched batch commands
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t remaining = paths.size();
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            workers_->submit([&, i]()
+                             {
+                run_one(i);
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--remaining == 0)
+                {
+                    done.notify_one();
+                } });
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&]()
+                  { return remaining == 0; });
+        return results;
+    }
+
+    CommandResult FileClient::merge_results(const std::vector<CommandResult> &results,
+                                            const std::string &separator)
+    {
+        if (results.size() == 1)
+        {
+            return results.front();
+        }
+
+        size_t failed = 0;
+        std::string body;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            if (i != 0)
+            {
+                body += separator;
+            }
+            if (!results[i].success)
+            {
+                failed++;
+                body += "Error: ";
+            }
+            body += results[i].message;
+        }
+        if (failed == 0)
+        {
+            return CommandResult(true, body);
+        }
+        return CommandResult(false, std::to_string(failed) + " of " + std::to_string(results.size()) +
+                                        " paths failed\n" + body);
+    }
+
+    std::vector<std::string> FileClient::split_script(const std::string &script)
+    {
+        std::vector<std::string> commands;
+        std::istringstream lines(script);
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#')
+            {
+                continue;
+            }
+            std::istringstream parts(line);
+            std::string part;
+            while (std::getline(parts, part, ';'))
+            {
+                if (part.find_first_not_of(" \t\r") != std::string::npos)
+                {
+                    commands.push_back(part);
+                }
+            }
+        }
+        return commands;
+    }
+
     // Private utility method implementations
 
     std::vector<std::string> FileClient::parse_command(const std::string &command_line)
@@ -689,80 +2540,126 @@ namespace file_client
 
     bool FileClient::is_text_file(const std::string &content)
     {
-        if (content.empty())
-            return true;
-
-        size_t non_printable = 0;
-        size_t total = std::min(content.size(), size_t(512)); // Only check first 512 bytes
+        // Only check first 512 bytes
+        return looks_like_text(reinterpret_cast<const unsigned char *>(content.data()),
+                               std::min(content.size(), size_t(512)));
+    }
 
-        size_t i = 0;
-        while (i < total)
+    std::string FileClient::parse_range_args(const std::vector<std::string> &args, size_t &offset,
+                                             size_t &length, std::string &filename)
+    {
+        for (size_t i = 0; i < args.size(); ++i)
         {
-            unsigned char c = static_cast<unsigned char>(content[i]);
-
-            // NULL bytes are directly considered binary
-            if (c == 0)
-                return false;
-
-            // ASCII control character detection
-            if (c < 32)
+            if (args[i] == "-offset" && i + 1 < args.size())
             {
-                if (c != '\t' && c != '\n' && c != '\r')
+                try
                 {
-                    non_printable++;
+                    offset = std::stoull(args[i + 1]);
+                    i++; // Skip next parameter
+                }
+                catch (const std::exception &)
+                {
+                    return "Invalid offset value: " + args[i + 1];
                 }
-                i++;
-                continue;
             }
-
-            // UTF-8 multi-byte check
-            size_t utf8_len = 0;
-            if (c >= 0x80)
+            else if (args[i] == "-len" && i + 1 < args.size())
             {
-                if ((c & 0xE0) == 0xC0)
-                    utf8_len = 2;
-                else if ((c & 0xF0) == 0xE0)
-                    utf8_len = 3;
-                else if ((c & 0xF8) == 0xF0)
-                    utf8_len = 4;
-                else
+                try
                 {
-                    // Invalid UTF-8 starting byte
-                    non_printable++;
-                    i++;
-                    continue;
+                    length = std::stoull(args[i + 1]);
+                    i++; // Skip next parameter
                 }
-
-                // Check if subsequent bytes are valid
-                bool valid = true;
-                for (size_t j = 1; j < utf8_len && (i + j) < total; ++j)
+                catch (const std::exception &)
                 {
-                    unsigned char cc = static_cast<unsigned char>(content[i + j]);
-                    if ((cc & 0xC0) != 0x80)
-                    {
-                        valid = false;
-                        break;
-                    }
+                    return "Invalid length value: " + args[i + 1];
                 }
+            }
+            else if (args[i][0] != '-')
+            {
+                filename = args[i];
+            }
+        }
+        return "";
+    }
 
-                if (!valid)
-                    non_printable++;
+    bool FileClient::parse_size(const std::string &text, size_t &value)
+    {
+        size_t unit = 1;
+        switch (text.empty() ? '\0' : text.back())
+        {
+        case 'k':
+        case 'K':
+            unit = 1024;
+            break;
+        case 'M':
+            unit = 1024 * 1024;
+            break;
+        case 'G':
+            unit = 1024 * 1024 * 1024;
+            break;
+        }
+        std::string digits = unit != 1 ? text.substr(0, text.size() - 1) : text;
+        if (digits.empty() || !std::isdigit(static_cast<unsigned char>(digits[0])))
+        {
+            return false;
+        }
+        try
+        {
+            size_t pos = 0;
+            value = std::stoull(digits, &pos) * unit;
+            return pos == digits.size();
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+    }
 
-                i += utf8_len;
-                continue;
+    std::string FileClient::json_quote(const std::string &text)
+    {
+        std::string quoted = "\"";
+        for (unsigned char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                quoted += '\\';
+                quoted += static_cast<char>(c);
+            }
+            else if (c < 0x20)
+            {
+                char escape[8];
+                std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                quoted += escape;
+            }
+            else
+            {
+                quoted += static_cast<char>(c);
             }
-
-            // Regular printable ASCII
-            i++;
         }
+        return quoted + "\"";
+    }
 
-        // If non-printable character ratio exceeds 30%, consider it binary
-        return (non_printable * 100 / total) < 30;
+    std::string FileClient::csv_field(const std::string &text)
+    {
+        if (text.find_first_of(",\"\r\n") == std::string::npos)
+        {
+            return text;
+        }
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            quoted += c;
+            if (c == '"')
+            {
+                quoted += '"';
+            }
+        }
+        return quoted + "\"";
     }
 
     std::string FileClient::get_prompt()
     {
-        SPDB_SDKFileSystem *spdb_sdk_fs = dynamic_cast<SPDB_SDKFileSystem *>(filesystem_.get());
+        SPDB_SDKFileSystem *spdb_sdk_fs = sdk_filesystem();
         if (spdb_sdk_fs)
         {
             return "[" + spdb_sdk_fs->get_real_system_path() + "] " +
@@ -13,13 +13,20 @@
 #pragma once
 
 #include "filesystem_interface.h"
+#include "instrumented_filesystem.h"
+#include "work_stealing_pool.h"
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
 namespace file_client
 {
 
+    class SPDB_SDKFileSystem;
+
     /**
      * @struct CommandResult
      * @brief Command execution result structure
@@ -67,6 +74,12 @@ namespace file_client
          */
         ~FileClient() = default;
 
+        /**
+         * @brief Set the stream that streaming commands (cat, hexdump) write into
+         * @param out Output stream, must outlive the client
+         */
+        void set_output_stream(std::ostream &out);
+
         /**
          * @name Command processing interface
          * @{
@@ -99,45 +112,67 @@ namespace file_client
          * @return Command execution result
          *
          * Supported usage:
-         * - ls [path]: List contents of specified path
-         * - ls -l [path]: List contents in detailed format
+         * - ls [path...]: List contents of specified paths
+         * - ls -l [path...]: List contents in detailed format
+         *
+         * @note Several paths or globs are listed concurrently and printed in argument order
          */
         CommandResult cmd_ls(const std::vector<std::string> &args);
 
         /**
          * @brief file command - Display file type
-         * @param args Command arguments, first argument is file path
+         * @param args Command arguments, one or more file paths or globs
          * @return Command execution result
          */
         CommandResult cmd_file(const std::vector<std::string> &args);
 
         /**
          * @brief stat command - Display detailed file information
-         * @param args Command arguments, first argument is file path
+         * @param args Command arguments, one or more file paths or globs
          * @return Command execution result
          */
         CommandResult cmd_stat(const std::vector<std::string> &args);
 
         /**
-         * This feature is temporarily disabled
-         *
          * @brief du command - Display directory size
-         * @param args Command arguments, supports -h option and path parameter
+         * @param args Command arguments, supports -h, --max-depth, -j options and path parameter
          * @return Command execution result
          *
          * Supported usage:
          * - du [path]: Display path size in bytes
          * - du -h [path]: Display size in human-readable format
+         * - du --max-depth N [path]: Also display subdirectories up to N levels deep
+         * - du -j N [path]: Walk the tree with N threads
          */
         CommandResult cmd_du(const std::vector<std::string> &args);
 
+        /**
+         * @brief find command - Search a directory tree
+         * @param args Command arguments, path followed by predicates
+         * @return Command execution result, one matching path per line
+         *
+         * Supported usage:
+         * - find [path] -name <glob>: Entries whose name matches glob, one pair of outer quotes is removed
+         * - find [path] -type f|d: Only regular files or directories
+         * - find [path] -size [+|-]N[k|M|G]: Size larger than, smaller than or equal to N bytes
+         * - find [path] -maxdepth N: Descend at most N levels below path
+         * - find -j N [path]: Walk the tree with N threads
+         *
+         * @note Entries are only stat'ed when -type or -size needs it or when they may be descended into
+         */
+        CommandResult cmd_find(const std::vector<std::string> &args);
+
         /**
          * @brief cat command - Display file contents
          * @param args Command arguments, first argument is file path
          * @return Command execution result
          *
+         * Supported usage:
+         * - cat <filename>: Display whole file
+         * - cat -offset N -len N <filename>: Display a byte range
+         *
          * @note Automatically detects binary files and refuses to display them
-         * @note Limits maximum file size to prevent memory issues
+         * @note Content is streamed chunk by chunk to the output stream, memory stays flat
          */
         CommandResult cmd_cat(const std::vector<std::string> &args);
 
@@ -159,17 +194,176 @@ namespace file_client
          * @brief hexdump command - Get offset addresses and hexadecimal bytes
          * @param args Command arguments (file path)
          * @return Command execution result
+         *
+         * Supported usage:
+         * - hexdump <file>: 8 bytes per line in binary with an ASCII column
+         * - hexdump -C <file>: Canonical 16 bytes per line hex+ASCII (like hexdump -C)
+         * - hexdump -w N <file>: N bytes per line in either mode
+         *
+         * @note Output is streamed chunk by chunk to the output stream, any range size is supported
          */
         CommandResult cmd_hexdump(const std::vector<std::string> &args);
 
+        /**
+         * @brief view command - Page through a file as hexdump or text
+         * @param args Command arguments
+         * @return Command execution result, a summary of how many block lookups were served from memory
+         *
+         * Supported usage:
+         * - view <file>: Canonical hexdump pager, DEFAULT_VIEW_WINDOW bytes per screen
+         * - view -text <file>: Raw content instead of hexdump
+         * - view -len N -offset N -page-size N <file>: Screen size (at most MAX_VIEW_WINDOW), start offset,
+         *   InnoDB page size for pg
+         *
+         * Pager keys: Enter/n next, b previous, o <offset> jump to offset, pg <N> jump to page N, q quit.
+         * The neighbouring blocks are read by a background thread while the current screen is shown.
+         *
+         * @note Without a terminal on stdin only the first screen is printed
+         */
+        CommandResult cmd_view(const std::vector<std::string> &args);
+
+        /**
+         * @brief dump command - Copy a file (or a range of it) to the local disk
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - dump <file> <local_path>: Copy the whole file, refuses to overwrite local_path
+         * - dump -f <file> <local_path>: Overwrite local_path if it exists
+         * - dump -offset N -len N <file> <local_path>: Copy only a byte range
+         * - dump -j N <file> <local_path>: Keep N reads in flight instead of the configured depth
+         *
+         * @note Also available as copy-out. A partial copy is removed on error
+         */
+        CommandResult cmd_dump(const std::vector<std::string> &args);
+
+        /**
+         * @brief pages command - Decode and verify InnoDB tablespace pages
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - pages <file.ibd>: Verify every page and print a summary
+         * - pages --range a-b <file.ibd>: Only scan pages a..b (inclusive)
+         * - pages --page-size N <file.ibd>: Override the page size read from page 0
+         * - pages -v <file.ibd>: Also list every page, not only damaged ones
+         *
+         * @note Pages are read in large sequential batches and verified with hardware CRC32C
+         */
+        CommandResult cmd_pages(const std::vector<std::string> &args);
+
+        /**
+         * @brief redoscan command - Validate InnoDB redo log files
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - redoscan <dir>: Scan every #ib_redo* file in the directory
+         * - redoscan <#ib_redoN>: Scan the redo files registered in the metadata slots
+         * - redoscan -j N <...>: Scan up to N files concurrently
+         *
+         * @note Each file is read sequentially with read-ahead, blocks are verified with CRC32C
+         */
+        CommandResult cmd_redoscan(const std::vector<std::string> &args);
+
+        /**
+         * @brief sum command - Checksum whole files
+         * @param args Command arguments
+         * @return Command execution result, one "crc32c size name" line per file
+         *
+         * Supported usage:
+         * - sum <filename...>: CRC32C of every file
+         * - sum -chunk N[k|M] <filename...>: Hash in N byte chunks (default 1M)
+         * - sum -j N <filename...>: Keep N chunks in flight (default: the backend's I/O depth)
+         * - sum -v <filename...>: Also list the checksum of every chunk
+         *
+         * @note Chunks are read and hashed in parallel and folded with crc32c_combine,
+         *       so the result matches a sequential CRC32C of the file
+         */
+        CommandResult cmd_sum(const std::vector<std::string> &args);
+
+        /**
+         * @brief cmp command - Compare two files, e.g. a tablespace and its backup
+         * @param args Command arguments
+         * @return Command execution result, fails when the files differ like cmp(1)
+         *
+         * Supported usage:
+         * - cmp <fileA> <fileB>: Report whether the files are identical
+         * - cmp -chunk N[k|M] -j N <fileA> <fileB>: Chunk size and chunks in flight, as for sum
+         * - cmp --page-size N <fileA> <fileB>: Page size used to report the differing page (default 16k)
+         * - cmp <fileA> local:<path>: Either operand may be a local file, e.g. the backup of an SDK tablespace
+         *
+         * @note Both files are checksummed concurrently, only the first differing chunk is read back
+         *       to locate the differing byte
+         */
+        CommandResult cmd_cmp(const std::vector<std::string> &args);
+
         /**
          * @brief Get file metadata command
-         * @param args Command arguments (filename)
+         * @param args Command arguments, one or more file paths or globs
          * @return Command execution result
+         *
+         * Supported usage:
+         * - meta <filename...>: Show the metadata of each file
+         * - meta -r <dir...>: Every *.ibd and #ib_redo* file below the directories
+         * - meta --format json|csv <...>: One compact record per file (CSV: one row per version),
+         *   per-file failures are reported inside the records
+         *
          * @note Only supports redolog and IBD files with metadata
+         * @note Files are fetched concurrently on the worker pool, results are cached per path
          */
         CommandResult cmd_meta(const std::vector<std::string> &args);
 
+        /**
+         * @brief cache command - Show or control the metadata cache and descriptor pool
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - cache: Display hit/miss counters
+         * - cache clear: Drop all cached entries
+         * - cache ttl <ms>: Set entry lifetime, 0 disables caching
+         */
+        CommandResult cmd_cache(const std::vector<std::string> &args);
+
+        /**
+         * @brief iostat command - Show latency histograms of the SDK calls made by this tool
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - iostat: Display count, average and p50/p99/p99.9/max latency per call class
+         * - iostat reset: Clear the histograms
+         */
+        CommandResult cmd_iostat(const std::vector<std::string> &args);
+
+        /**
+         * @brief timing command - Report the cost of every following command
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - timing on: Append wall time, file system calls with their time and bytes,
+         *   and the SDK calls issued (stat, open, pread bytes, opendir) to each command result
+         * - timing off: Stop reporting
+         * - timing: Show the current setting
+         *
+         * @note Batch mode stops prefetching while timing is on so the counters of
+         *       concurrent commands do not mix
+         */
+        CommandResult cmd_timing(const std::vector<std::string> &args);
+
+        /**
+         * @brief stats command - Show cumulative command and file system call totals
+         * @param args Command arguments
+         * @return Command execution result
+         *
+         * Supported usage:
+         * - stats: Display commands run, their wall time and per call class count, time and bytes
+         * - stats reset: Clear the totals
+         */
+        CommandResult cmd_stats(const std::vector<std::string> &args);
+
         /**
          * @brief help command - Display help information
          * @param args Command arguments (ignored)
@@ -192,8 +386,33 @@ namespace file_client
          */
         void run_interactive();
 
+        /**
+         * @brief Run commands non-interactively
+         * @param commands Command lines, executed in order
+         * @return Number of commands that failed
+         *
+         * Results are written to the output stream in command order. Read-only commands
+         * (ls, stat, file, meta, du, find, pwd) are started up to BATCH_PREFETCH_DEPTH commands
+         * ahead of the output so their I/O overlaps; every other command waits for the
+         * commands before it to finish. exit/quit stops the batch. With timing on every
+         * command runs in order.
+         */
+        size_t run_batch(const std::vector<std::string> &commands);
+
+        /**
+         * @brief Split a script into command lines
+         * @param script Script text, commands separated by newlines or ';'
+         * @return Non-empty command lines, '#' comment lines are skipped
+         */
+        static std::vector<std::string> split_script(const std::string &script);
+
         /** @} */
 
+        static constexpr size_t BATCH_PREFETCH_DEPTH = 16; ///< Commands executed ahead of output in batch mode
+        static constexpr size_t DEFAULT_WORKER_THREADS = 16; ///< Threads serving multi-path commands
+        static constexpr size_t DEFAULT_VIEW_WINDOW = 512;   ///< Bytes per view screen
+        static constexpr size_t MAX_VIEW_WINDOW = 1024 * 1024; ///< Largest -len for view, bounds the prefetched blocks
+
         /**
          * @name Helper methods
          * @{
@@ -208,7 +427,13 @@ namespace file_client
         /** @} */
 
     private:
-        std::unique_ptr<FileSystemInterface> filesystem_; ///< File system interface pointer
+        std::unique_ptr<FileSystemInterface> filesystem_; ///< File system interface pointer (the accounting decorator)
+        InstrumentedFileSystem *instrumented_;            ///< filesystem_ as its concrete type
+        std::ostream *output_;                            ///< Destination of streamed command output
+        std::unique_ptr<WorkStealingPool> workers_;       ///< Shared by commands that take several paths
+        std::atomic<bool> timing_{false};                 ///< Append per-command costs to results
+        std::atomic<uint64_t> commands_run_{0};           ///< Commands executed, for stats
+        std::atomic<uint64_t> command_nanos_{0};          ///< Wall time of those commands, for stats
 
         /**
          * @name Private utility methods
@@ -243,9 +468,95 @@ namespace file_client
          * Uses heuristic methods to detect if file contains text content:
          * - Checks for presence of NULL characters
          * - Calculates ratio of non-printable characters
+         *
+         * @see looks_like_text for the SIMD kernel, only the first 512 bytes are examined
          */
         bool is_text_file(const std::string &content);
 
+        /**
+         * @brief Parse -offset/-len options shared by streaming commands
+         * @param args Command arguments
+         * @param offset Output starting offset
+         * @param length Output read length (0 means to end of file)
+         * @param filename Output positional file name
+         * @return Empty string on success, error message otherwise
+         */
+        std::string parse_range_args(const std::vector<std::string> &args, size_t &offset,
+                                     size_t &length, std::string &filename);
+
+        /**
+         * @brief Parse a byte count with an optional k, M or G suffix
+         * @param text Value as typed, e.g. "512", "64k" or "1M"
+         * @param value Output byte count
+         * @return Whether text was a valid size
+         */
+        static bool parse_size(const std::string &text, size_t &value);
+
+        /**
+         * @brief Expand wildcards in the last component of each path
+         * @param patterns Paths as typed, '*', '?' and '[...]' are supported in the last component
+         * @return Matching paths in argument order, matches of one pattern sorted by name;
+         *         a pattern without matches is kept as is so the command reports it
+         */
+        std::vector<std::string> expand_paths(const std::vector<std::string> &patterns);
+
+        /**
+         * @brief Run a single-path command body for every path on the worker pool
+         * @param paths Paths to process
+         * @param func Command body for one path
+         * @return Results in the order of paths
+         */
+        std::vector<CommandResult> run_per_path(const std::vector<std::string> &paths,
+                                                const std::function<CommandResult(const std::string &)> &func);
+
+        /**
+         * @brief The SPDB SDK backend behind the accounting decorator
+         * @return Backend pointer, nullptr for other file system implementations
+         */
+        SPDB_SDKFileSystem *sdk_filesystem();
+
+        /**
+         * @brief Format the cost of one command from counters taken before and after it
+         * @param nanos Command wall time
+         * @param before Decorator counters before the command
+         * @param after Decorator counters after the command
+         * @param sdk_before SDK call counts and pread bytes before the command (empty if unavailable)
+         * @return One line summary
+         */
+        std::string format_timing(uint64_t nanos, const InstrumentedFileSystem::Snapshot &before,
+                                  const InstrumentedFileSystem::Snapshot &after,
+                                  const std::vector<uint64_t> &sdk_before);
+
+        /**
+         * @brief SDK call counts per IoOp followed by pread bytes (empty if the backend is not the SDK)
+         */
+        std::vector<uint64_t> sdk_counters();
+
+        /**
+         * @brief Join per-path results into one command result
+         * @param results Results in output order
+         * @param separator Text put between consecutive results
+         * @return Success only if every path succeeded, failures are listed inline
+         */
+        static CommandResult merge_results(const std::vector<CommandResult> &results,
+                                           const std::string &separator);
+
+        CommandResult ls_one(const std::string &target_path, bool long_format, bool with_header);
+        CommandResult file_one(const std::string &filename);
+        CommandResult stat_one(const std::string &filename);
+        CommandResult meta_one(const std::string &filename);
+        CommandResult meta_record(const std::string &filename, bool csv);
+
+        /**
+         * @brief Quote a string as a JSON string literal
+         */
+        static std::string json_quote(const std::string &text);
+
+        /**
+         * @brief Quote a CSV field when it contains a separator, quote or line break
+         */
+        static std::string csv_field(const std::string &text);
+
         /** @} */
     };
 
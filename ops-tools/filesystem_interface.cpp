@@ -14,6 +14,8 @@
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <cstring>
+#include <strings.h>
 
 namespace file_client
 {
@@ -124,6 +126,22 @@ namespace file_client
         }
     }
 
+    MetadataKind FileSystemInterface::metadata_kind(const std::string &path)
+    {
+        size_t slash = path.find_last_of('/');
+        const char *name = path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+        size_t length = path.size() - (name - path.c_str());
+        if (length >= 4 && strcasecmp(name + length - 4, ".ibd") == 0)
+        {
+            return MetadataKind::IBD;
+        }
+        if (std::strncmp(name, "#ib_redo", 8) == 0)
+        {
+            return MetadataKind::REDO;
+        }
+        return MetadataKind::NONE;
+    }
+
     // Factory method implementations
     std::unique_ptr<FileSystemInterface> FileSystemFactory::create(Type type)
     {
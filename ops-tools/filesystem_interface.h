@@ -11,9 +11,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <ctime>
@@ -57,6 +59,122 @@ namespace file_client
         std::string permissions_str; ///< Permission string representation (e.g.: drwxr-xr-x)
     };
 
+    /**
+     * @struct DirectoryUsage
+     * @brief Disk usage of one directory subtree
+     */
+    struct DirectoryUsage
+    {
+        std::string path; ///< Path relative to the walked directory ("" for the directory itself)
+        size_t size;      ///< Total size of regular files in the subtree (bytes)
+        int depth;        ///< Depth below the walked directory (0 for the directory itself)
+    };
+
+    /**
+     * @struct FindQuery
+     * @brief Predicates of a find walk
+     *
+     * The name is checked first, stat is only issued when a type or size predicate
+     * must be evaluated or the entry may be a directory to descend into.
+     */
+    struct FindQuery
+    {
+        std::string name_glob;  ///< fnmatch pattern on the entry name, empty matches everything
+        FileType type = FileType::UNKNOWN; ///< Required type, UNKNOWN accepts any type
+        int size_compare = 0;   ///< Size predicate: -1 smaller than, 0 equal to, 1 larger than size
+        bool has_size = false;  ///< Whether the size predicate is set
+        size_t size = 0;        ///< Size predicate operand (bytes)
+        int max_depth = -1;     ///< Deepest level to report, 1 is the walked directory's entries, negative means unlimited
+
+        bool needs_stat() const { return type != FileType::UNKNOWN || has_size; }
+    };
+
+    /**
+     * @struct FoundEntry
+     * @brief One match of a find walk
+     */
+    struct FoundEntry
+    {
+        std::string path;  ///< Path relative to the walked directory
+        bool has_stat;     ///< Whether the entry was stat'ed, so its size is known
+        FileType type;     ///< File type, from readdir or the stat, UNKNOWN if neither was available
+        size_t size;       ///< File size (bytes), 0 unless has_stat
+    };
+
+    /**
+     * @struct FileChecksum
+     * @brief Chunked CRC32C of a whole file
+     */
+    struct FileChecksum
+    {
+        uint64_t size = 0;            ///< Bytes checksummed (the file size)
+        size_t chunk_size = 0;        ///< Chunk length, only the last chunk may be shorter
+        std::vector<uint32_t> chunks; ///< CRC32C of every chunk in file order
+        uint32_t crc = 0;             ///< CRC32C of the whole file, folded from the chunk checksums
+    };
+
+    /**
+     * @enum MetadataKind
+     * @brief Kind of SDK metadata a file carries, decided by its name
+     */
+    enum class MetadataKind
+    {
+        NONE, ///< No metadata
+        IBD,  ///< Tablespace, *.ibd
+        REDO  ///< Redo log, #ib_redo*
+    };
+
+    /**
+     * @struct FileMetadata
+     * @brief SDK metadata of a tablespace or redo log file
+     *
+     * Only the fields of the file's kind are set.
+     */
+    struct FileMetadata
+    {
+        /** One tablespace version */
+        struct Version
+        {
+            std::string uuid;
+            uint64_t start_lsn = 0;
+            uint64_t end_lsn = 0;
+            uint32_t space_id = 0;
+            bool read_only = false;
+        };
+
+        /** One redo metadata slot */
+        struct Slot
+        {
+            uint32_t id = 0;
+            bool in_use = false;
+            std::string file_name;
+        };
+
+        MetadataKind kind = MetadataKind::NONE;
+
+        // Tablespace
+        std::string uuid;
+        uint32_t space_id = 0;
+        uint32_t shard_count = 0;
+        uint64_t block_count = 0;
+        std::vector<Version> versions;
+
+        // Redo log
+        uint64_t cluster_id = 0;
+        std::string cluster_uuid;
+        uint64_t chunk_size = 0;
+        uint64_t chunk_count = 0;
+        std::vector<Slot> slots;
+    };
+
+    /**
+     * @brief Consumer for streaming file reads
+     *
+     * Called once per chunk in file order with the chunk data, its size and the
+     * absolute file offset of its first byte. Return false to stop reading early.
+     */
+    using ChunkCallback = std::function<bool(const char *data, size_t size, size_t offset)>;
+
     /**
      * @class FileSystemInterface
      * @brief File system abstract interface class
@@ -71,6 +189,12 @@ namespace file_client
     class FileSystemInterface
     {
     public:
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 256 * 1024; ///< Default streaming read chunk (bytes)
+        static constexpr size_t DEFAULT_STAT_CONCURRENCY = 32;    ///< Default stat requests in flight per listing
+        static constexpr size_t DEFAULT_WALK_THREADS = 8;         ///< Default threads for recursive walks
+        static constexpr size_t DEFAULT_IO_DEPTH = 8;             ///< Default reads in flight for parallel range reads
+        static constexpr size_t DEFAULT_CHECKSUM_CHUNK = 1024 * 1024; ///< Default chunk for checksum_file (bytes)
+
         /**
          * @brief Virtual destructor
          */
@@ -86,9 +210,25 @@ namespace file_client
          * @param path Directory path
          * @return File information list
          * @throw std::runtime_error if directory does not exist or cannot be accessed
+         *
+         * Only name and type are guaranteed; a backend may leave size, mode and
+         * times at 0 for entries whose type readdir already reported.
          */
         virtual std::vector<FileInfo> list_directory(const std::string &path) = 0;
 
+        /**
+         * @brief List directory contents, fetching entry stats in bulk
+         * @param path Directory path
+         * @param max_in_flight Maximum number of stat requests outstanding at once
+         * @return File information list sorted by name
+         * @throw std::runtime_error if directory does not exist or cannot be accessed
+         *
+         * Reads all entry names first, then resolves their stats concurrently so a
+         * listing costs about one round trip per max_in_flight entries instead of one per entry.
+         */
+        virtual std::vector<FileInfo> list_directory_with_stats(const std::string &path,
+                                                                size_t max_in_flight = DEFAULT_STAT_CONCURRENCY) = 0;
+
         /**
          * @brief Check if path is a directory
          * @param path File path
@@ -142,6 +282,29 @@ namespace file_client
          */
         virtual size_t get_directory_size(const std::string &path, bool recursive = true) = 0;
 
+        /**
+         * @brief Get per-directory usage of a directory tree
+         * @param path Directory path
+         * @param max_depth Deepest directory level to report, negative means unlimited
+         * @param threads Number of walker threads
+         * @return Usage of every reported directory, children before their parent,
+         *         the walked directory itself is always the last element
+         * @throw std::runtime_error if directory does not exist or cannot be accessed
+         */
+        virtual std::vector<DirectoryUsage> get_directory_usage(const std::string &path, int max_depth = 0,
+                                                                size_t threads = DEFAULT_WALK_THREADS) = 0;
+
+        /**
+         * @brief Search a directory tree
+         * @param path Directory to walk, or a single file to test
+         * @param query Predicates entries must satisfy
+         * @param threads Number of walker threads
+         * @return Matching entries sorted by path
+         * @throw std::runtime_error if path does not exist
+         */
+        virtual std::vector<FoundEntry> find(const std::string &path, const FindQuery &query,
+                                             size_t threads = DEFAULT_WALK_THREADS) = 0;
+
         /** @} */
 
         /**
@@ -168,6 +331,53 @@ namespace file_client
          */
         virtual std::string read_file_content_at_offset(const std::string &path, size_t offset, size_t length = 0) = 0;
 
+        /**
+         * @brief Stream file content through a callback in fixed-size chunks
+         * @param path File path
+         * @param offset Starting read offset
+         * @param length Read length, 0 means read to end of file
+         * @param callback Chunk consumer, invoked in file order
+         * @param chunk_size Chunk size in bytes (rounded up to the I/O alignment)
+         * @param readahead Number of chunks a background reader may fetch ahead of the callback,
+         *                  0 reads synchronously
+         * @return Total number of bytes delivered to the callback
+         * @throw std::runtime_error if file cannot be read or offset exceeds file size
+         * @note Memory usage is bounded by (readahead + 1) * chunk_size regardless of the range length
+         */
+        virtual size_t read_file_chunks(const std::string &path, size_t offset, size_t length,
+                                        const ChunkCallback &callback,
+                                        size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                                        size_t readahead = 0) = 0;
+
+        /**
+         * @brief Read a range with several aligned sub-requests in flight at once
+         * @param path File path
+         * @param offset Starting read offset
+         * @param length Read length, 0 means read to end of file
+         * @param callback Chunk consumer, invoked in file order with one sub-request per call
+         * @param request_size Sub-request size in bytes (rounded up to the I/O alignment)
+         * @param depth Sub-requests in flight, 0 uses the backend's configured depth
+         * @return Total number of bytes delivered to the callback
+         * @throw std::runtime_error if file cannot be read or offset exceeds file size
+         * @note Meant for high-latency backends, memory usage is bounded by 2 * depth * request_size
+         */
+        virtual size_t read_file_range_parallel(const std::string &path, size_t offset, size_t length,
+                                                const ChunkCallback &callback,
+                                                size_t request_size = DEFAULT_CHUNK_SIZE,
+                                                size_t depth = 0) = 0;
+
+        /**
+         * @brief Checksum a file in fixed-size chunks, reading and hashing several chunks at once
+         * @param path File path
+         * @param chunk_size Chunk size in bytes (rounded up to the I/O alignment)
+         * @param depth Chunks in flight, 0 uses the backend's configured depth
+         * @return Per-chunk and whole-file CRC32C
+         * @throw std::runtime_error if file cannot be read or changes size while being read
+         * @note Chunks are hashed on the threads that read them, memory usage is bounded by depth * chunk_size
+         */
+        virtual FileChecksum checksum_file(const std::string &path, size_t chunk_size = DEFAULT_CHECKSUM_CHUNK,
+                                           size_t depth = 0) = 0;
+
         /**
          * @brief Get file metadata
          * @param path File path
@@ -184,6 +394,15 @@ namespace file_client
          */
         virtual bool has_file_metadata(const std::string &path) = 0;
 
+        /**
+         * @brief Get file metadata as a structure
+         * @param path File path
+         * @return Metadata, shared with the backend's cache and never modified
+         * @throw std::runtime_error if file does not exist, has no metadata or it cannot be retrieved
+         * @note Safe to call concurrently, bulk scans fetch many files at once
+         */
+        virtual std::shared_ptr<const FileMetadata> read_file_metadata(const std::string &path) = 0;
+
         /** @} */
 
         /**
@@ -248,6 +467,13 @@ namespace file_client
          */
         static std::string get_file_type_string(FileType type);
 
+        /**
+         * @brief Kind of metadata a file carries, from its name only
+         * @param path File path or name
+         * @return IBD for *.ibd (any case), REDO for #ib_redo*, NONE otherwise
+         */
+        static MetadataKind metadata_kind(const std::string &path);
+
         /** @} */
     };
 
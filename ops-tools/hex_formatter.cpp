@@ -0,0 +1,162 @@
+/**
+ * @file hex_formatter.cpp
+ * @brief Table-driven hexdump line formatter implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "hex_formatter.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace file_client
+{
+
+    namespace
+    {
+        constexpr size_t MIN_OFFSET_DIGITS = 8;
+        constexpr size_t CANONICAL_GROUP = 8; ///< Extra space after every 8 bytes in -C mode
+
+        struct Tables
+        {
+            char hex[256][2];    ///< Two lowercase hex digits per byte
+            char binary[256][8]; ///< Eight '0'/'1' digits per byte, MSB first
+            char ascii[256];     ///< Printable character or '.'
+
+            Tables()
+            {
+                static const char digits[] = "0123456789abcdef";
+                for (int b = 0; b < 256; ++b)
+                {
+                    hex[b][0] = digits[b >> 4];
+                    hex[b][1] = digits[b & 0xF];
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        binary[b][bit] = ((b >> (7 - bit)) & 1) ? '1' : '0';
+                    }
+                    ascii[b] = (b >= 0x20 && b < 0x7F) ? static_cast<char>(b) : '.';
+                }
+            }
+        };
+
+        const Tables &tables()
+        {
+            static const Tables instance;
+            return instance;
+        }
+
+        /** Hex offset, at least 8 digits like std::setw(8) */
+        char *write_offset(uint64_t offset, char *out)
+        {
+            static const char digits[] = "0123456789abcdef";
+            size_t count = MIN_OFFSET_DIGITS;
+            while (count < 16 && (offset >> (count * 4)) != 0)
+            {
+                count++;
+            }
+            for (size_t i = count; i > 0; --i)
+            {
+                out[i - 1] = digits[offset & 0xF];
+                offset >>= 4;
+            }
+            return out + count;
+        }
+    }
+
+    HexFormatter::HexFormatter(HexdumpMode mode, size_t bytes_per_line)
+        : mode_(mode),
+          bytes_per_line_(bytes_per_line != 0 ? std::min(bytes_per_line, MAX_BYTES_PER_LINE)
+                                              : (mode == HexdumpMode::BINARY ? 8 : 16))
+    {
+    }
+
+    size_t HexFormatter::max_line_length() const
+    {
+        // 16 offset digits, separators, per-byte columns, ASCII column, "||" and newline
+        size_t per_byte = mode_ == HexdumpMode::BINARY ? 9 : 3;
+        return 16 + 2 + bytes_per_line_ * per_byte + bytes_per_line_ / CANONICAL_GROUP + 1 + bytes_per_line_ + 3;
+    }
+
+    size_t HexFormatter::format(const unsigned char *data, size_t size, uint64_t base_offset, char *out) const
+    {
+        char *pos = out;
+        for (size_t line = 0; line < size; line += bytes_per_line_)
+        {
+            pos = format_line(data + line, std::min(bytes_per_line_, size - line), base_offset + line, pos);
+        }
+        return static_cast<size_t>(pos - out);
+    }
+
+    size_t HexFormatter::format_end(uint64_t end_offset, char *out) const
+    {
+        if (mode_ != HexdumpMode::CANONICAL)
+        {
+            return 0;
+        }
+        char *pos = write_offset(end_offset, out);
+        *pos++ = '\n';
+        return static_cast<size_t>(pos - out);
+    }
+
+    char *HexFormatter::format_line(const unsigned char *data, size_t count, uint64_t offset, char *out) const
+    {
+        const Tables &tb = tables();
+        out = write_offset(offset, out);
+
+        if (mode_ == HexdumpMode::BINARY)
+        {
+            *out++ = ':';
+            *out++ = ' ';
+            for (size_t i = 0; i < count; ++i)
+            {
+                std::memcpy(out, tb.binary[data[i]], 8);
+                out[8] = ' ';
+                out += 9;
+            }
+            // Pad a short last line so the ASCII column stays aligned
+            std::memset(out, ' ', (bytes_per_line_ - count) * 9 + 1);
+            out += (bytes_per_line_ - count) * 9 + 1;
+            for (size_t i = 0; i < count; ++i)
+            {
+                *out++ = tb.ascii[data[i]];
+            }
+            std::memset(out, ' ', bytes_per_line_ - count);
+            out += bytes_per_line_ - count;
+        }
+        else
+        {
+            *out++ = ' ';
+            *out++ = ' ';
+            for (size_t i = 0; i < bytes_per_line_; ++i)
+            {
+                if (i < count)
+                {
+                    out[0] = tb.hex[data[i]][0];
+                    out[1] = tb.hex[data[i]][1];
+                }
+                else
+                {
+                    out[0] = out[1] = ' ';
+                }
+                out[2] = ' ';
+                out += 3;
+                if ((i + 1) % CANONICAL_GROUP == 0 && i + 1 < bytes_per_line_)
+                {
+                    *out++ = ' ';
+                }
+            }
+            *out++ = ' ';
+            *out++ = '|';
+            for (size_t i = 0; i < count; ++i)
+            {
+                *out++ = tb.ascii[data[i]];
+            }
+            *out++ = '|';
+        }
+        *out++ = '\n';
+        return out;
+    }
+
+} // namespace file_client
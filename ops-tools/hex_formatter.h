@@ -0,0 +1,82 @@
+/**
+ * @file hex_formatter.h
+ * @brief Table-driven hexdump line formatter
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Formats whole hexdump lines straight into a caller-provided char buffer
+ * using precomputed per-byte digit tables, so dumping is bound by the output
+ * pipe rather than by iostream formatting.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace file_client
+{
+
+    /**
+     * @enum HexdumpMode
+     * @brief Hexdump output layout
+     */
+    enum class HexdumpMode
+    {
+        BINARY,   ///< "00000000: 01000001 ...  A..." (8 bits per byte, the historical default)
+        CANONICAL ///< "00000000  41 42 ...  |AB..|" (hexdump -C)
+    };
+
+    /**
+     * @class HexFormatter
+     * @brief Formats data as hexdump lines into a preallocated buffer
+     */
+    class HexFormatter
+    {
+    public:
+        static constexpr size_t MAX_BYTES_PER_LINE = 256; ///< Upper bound for the line width
+
+        /**
+         * @brief Constructor
+         * @param mode Output layout
+         * @param bytes_per_line Bytes per line, 0 selects the mode default (8 binary, 16 canonical)
+         */
+        explicit HexFormatter(HexdumpMode mode, size_t bytes_per_line = 0);
+
+        /**
+         * @brief Bytes shown on a full line
+         */
+        size_t bytes_per_line() const { return bytes_per_line_; }
+
+        /**
+         * @brief Upper bound of output bytes for one line, used to size buffers
+         */
+        size_t max_line_length() const;
+
+        /**
+         * @brief Format data as consecutive lines
+         * @param data Bytes to format
+         * @param size Number of bytes, only the last line may be partial
+         * @param base_offset File offset of data[0]
+         * @param out Destination, must hold lines * max_line_length() bytes
+         * @return Number of bytes written to out
+         */
+        size_t format(const unsigned char *data, size_t size, uint64_t base_offset, char *out) const;
+
+        /**
+         * @brief Format the closing offset line printed after the data (canonical mode only)
+         * @param end_offset File offset just past the last byte
+         * @param out Destination, must hold max_line_length() bytes
+         * @return Number of bytes written to out
+         */
+        size_t format_end(uint64_t end_offset, char *out) const;
+
+    private:
+        char *format_line(const unsigned char *data, size_t count, uint64_t offset, char *out) const;
+
+        HexdumpMode mode_;
+        size_t bytes_per_line_;
+    };
+
+} // namespace file_client
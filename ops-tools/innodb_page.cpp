@@ -0,0 +1,212 @@
+/**
+ * @file innodb_page.cpp
+ * @brief InnoDB tablespace page decoding implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "innodb_page.h"
+#include "crc32c.h"
+
+#include <cstring>
+#include <unordered_map>
+
+namespace file_client
+{
+namespace innodb
+{
+
+    namespace
+    {
+        bool is_all_zero(const unsigned char *page, size_t size)
+        {
+            // Word-at-a-time scan, untouched pages are common at the end of a tablespace
+            const unsigned char *end = page + size;
+            for (; page + sizeof(uint64_t) <= end; page += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, page, sizeof(word));
+                if (word != 0)
+                {
+                    return false;
+                }
+            }
+            for (; page < end; ++page)
+            {
+                if (*page != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /** buf_calc_page_crc32: skips the checksum, flush LSN/space id fields and the trailer */
+        uint32_t calc_page_crc32(const unsigned char *page, size_t page_size)
+        {
+            uint32_t c1 = crc32c(page + FIL_PAGE_OFFSET, FIL_PAGE_FILE_FLUSH_LSN - FIL_PAGE_OFFSET);
+            uint32_t c2 = crc32c(page + FIL_PAGE_DATA, page_size - FIL_PAGE_DATA - FIL_PAGE_END_LSN_OLD_CHKSUM);
+            return c1 ^ c2;
+        }
+
+        /** page_zip_calc_checksum with SRV_CHECKSUM_ALGORITHM_CRC32 */
+        uint32_t calc_zip_page_crc32(const unsigned char *page, size_t page_size)
+        {
+            uint32_t c1 = crc32c(page + FIL_PAGE_OFFSET, FIL_PAGE_LSN - FIL_PAGE_OFFSET);
+            uint32_t c2 = crc32c(page + FIL_PAGE_TYPE, 2);
+            uint32_t c3 = crc32c(page + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID,
+                                 page_size - FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID);
+            return c1 ^ c2 ^ c3;
+        }
+    }
+
+    PageHeader parse_header(const unsigned char *page)
+    {
+        PageHeader header;
+        header.checksum = read_be32(page + FIL_PAGE_SPACE_OR_CHKSUM);
+        header.page_no = read_be32(page + FIL_PAGE_OFFSET);
+        header.prev = read_be32(page + FIL_PAGE_PREV);
+        header.next = read_be32(page + FIL_PAGE_NEXT);
+        header.lsn = read_be64(page + FIL_PAGE_LSN);
+        header.type = read_be16(page + FIL_PAGE_TYPE);
+        header.space_id = read_be32(page + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID);
+        return header;
+    }
+
+    PageCheck check_page(const unsigned char *page, size_t page_size, bool compressed)
+    {
+        PageCheck check;
+        check.header = parse_header(page);
+        check.calculated = 0;
+
+        if (is_all_zero(page, page_size))
+        {
+            check.status = PageStatus::EMPTY;
+            return check;
+        }
+
+        uint16_t type = check.header.type;
+        if (type == FIL_PAGE_COMPRESSED || type == FIL_PAGE_ENCRYPTED ||
+            type == FIL_PAGE_COMPRESSED_AND_ENCRYPTED || type == FIL_PAGE_ENCRYPTED_RTREE)
+        {
+            check.status = PageStatus::NOT_VERIFIED;
+            return check;
+        }
+
+        if (check.header.checksum == BUF_NO_CHECKSUM_MAGIC)
+        {
+            check.status = PageStatus::NO_CHECKSUM;
+            return check;
+        }
+
+        if (compressed)
+        {
+            check.calculated = calc_zip_page_crc32(page, page_size);
+            check.status = check.calculated == check.header.checksum ? PageStatus::OK
+                                                                      : PageStatus::CHECKSUM_MISMATCH;
+            return check;
+        }
+
+        // The low 32 bits of the LSN are repeated in the trailer, a mismatch means a torn write
+        const unsigned char *trailer = page + page_size - FIL_PAGE_END_LSN_OLD_CHKSUM;
+        if (read_be32(trailer + 4) != static_cast<uint32_t>(check.header.lsn))
+        {
+            check.status = PageStatus::LSN_MISMATCH;
+            return check;
+        }
+
+        check.calculated = calc_page_crc32(page, page_size);
+        check.status = check.calculated == check.header.checksum ? PageStatus::OK
+                                                                  : PageStatus::CHECKSUM_MISMATCH;
+        return check;
+    }
+
+    size_t page_size_from_flags(uint32_t flags, bool &compressed)
+    {
+        // FSP_FLAGS_POS_ZIP_SSIZE = 1, FSP_FLAGS_POS_PAGE_SSIZE = 6, both 4 bits wide
+        uint32_t zip_ssize = (flags >> 1) & 0xF;
+        uint32_t page_ssize = (flags >> 6) & 0xF;
+
+        // 0 means the default 16K, otherwise 3 (4K) to 7 (64K) and zip sizes 1 (1K) to 5 (16K)
+        if ((page_ssize != 0 && (page_ssize < 3 || page_ssize > 7)) || zip_ssize > 5)
+        {
+            compressed = false;
+            return 0;
+        }
+
+        compressed = zip_ssize != 0;
+        if (compressed)
+        {
+            return size_t(512) << zip_ssize;
+        }
+        if (page_ssize == 0)
+        {
+            return UNIV_PAGE_SIZE_DEF;
+        }
+        return size_t(512) << page_ssize;
+    }
+
+    std::string page_type_name(uint16_t type)
+    {
+        static const std::unordered_map<uint16_t, std::string> names = {
+            {FIL_PAGE_INDEX, "INDEX"},
+            {FIL_PAGE_RTREE, "RTREE"},
+            {FIL_PAGE_SDI, "SDI"},
+            {FIL_PAGE_TYPE_ALLOCATED, "ALLOCATED"},
+            {2, "UNDO_LOG"},
+            {3, "INODE"},
+            {4, "IBUF_FREE_LIST"},
+            {5, "IBUF_BITMAP"},
+            {6, "SYS"},
+            {7, "TRX_SYS"},
+            {8, "FSP_HDR"},
+            {9, "XDES"},
+            {10, "BLOB"},
+            {11, "ZBLOB"},
+            {12, "ZBLOB2"},
+            {13, "UNKNOWN"},
+            {FIL_PAGE_COMPRESSED, "COMPRESSED"},
+            {FIL_PAGE_ENCRYPTED, "ENCRYPTED"},
+            {FIL_PAGE_COMPRESSED_AND_ENCRYPTED, "COMPRESSED_AND_ENCRYPTED"},
+            {FIL_PAGE_ENCRYPTED_RTREE, "ENCRYPTED_RTREE"},
+            {18, "SDI_BLOB"},
+            {19, "SDI_ZBLOB"},
+            {20, "LEGACY_DBLWR"},
+            {21, "RSEG_ARRAY"},
+            {22, "LOB_INDEX"},
+            {23, "LOB_DATA"},
+            {24, "LOB_FIRST"},
+            {25, "ZLOB_FIRST"},
+            {26, "ZLOB_DATA"},
+            {27, "ZLOB_INDEX"},
+            {28, "ZLOB_FRAG"},
+            {29, "ZLOB_FRAG_ENTRY"},
+        };
+        auto it = names.find(type);
+        return it != names.end() ? it->second : "TYPE_" + std::to_string(type);
+    }
+
+    const char *page_status_name(PageStatus status)
+    {
+        switch (status)
+        {
+        case PageStatus::OK:
+            return "ok";
+        case PageStatus::EMPTY:
+            return "empty";
+        case PageStatus::NO_CHECKSUM:
+            return "no checksum";
+        case PageStatus::NOT_VERIFIED:
+            return "not verified";
+        case PageStatus::CHECKSUM_MISMATCH:
+            return "CHECKSUM MISMATCH";
+        case PageStatus::LSN_MISMATCH:
+            return "LSN MISMATCH (torn)";
+        default:
+            return "unknown";
+        }
+    }
+
+} // namespace innodb
+} // namespace file_client
@@ -0,0 +1,221 @@
+/**
+ * @file instrumented_filesystem.cpp
+ * @brief Call accounting decorator implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "instrumented_filesystem.h"
+
+namespace file_client
+{
+
+    InstrumentedFileSystem::InstrumentedFileSystem(std::unique_ptr<FileSystemInterface> inner)
+        : inner_(std::move(inner))
+    {
+    }
+
+    InstrumentedFileSystem::Scope::Scope(InstrumentedFileSystem &owner, FsCall call)
+        : counters_(owner.counters_[static_cast<size_t>(call)]), start_(Clock::now())
+    {
+    }
+
+    InstrumentedFileSystem::Scope::~Scope()
+    {
+        auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_).count();
+        counters_.calls.fetch_add(1, std::memory_order_relaxed);
+        counters_.nanos.fetch_add(static_cast<uint64_t>(nanos), std::memory_order_relaxed);
+        if (bytes_ != 0)
+        {
+            counters_.bytes.fetch_add(bytes_, std::memory_order_relaxed);
+        }
+    }
+
+    InstrumentedFileSystem::Snapshot InstrumentedFileSystem::snapshot() const
+    {
+        Snapshot snap;
+        for (size_t i = 0; i < snap.size(); ++i)
+        {
+            snap[i].calls = counters_[i].calls.load(std::memory_order_relaxed);
+            snap[i].nanos = counters_[i].nanos.load(std::memory_order_relaxed);
+            snap[i].bytes = counters_[i].bytes.load(std::memory_order_relaxed);
+        }
+        return snap;
+    }
+
+    void InstrumentedFileSystem::reset()
+    {
+        for (auto &counters : counters_)
+        {
+            counters.calls.store(0, std::memory_order_relaxed);
+            counters.nanos.store(0, std::memory_order_relaxed);
+            counters.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const char *InstrumentedFileSystem::call_name(FsCall call)
+    {
+        switch (call)
+        {
+        case FsCall::STAT:
+            return "stat";
+        case FsCall::LIST:
+            return "list";
+        case FsCall::WALK:
+            return "walk";
+        case FsCall::READ:
+            return "read";
+        case FsCall::METADATA:
+            return "metadata";
+        case FsCall::CHDIR:
+            return "chdir";
+        default:
+            return "unknown";
+        }
+    }
+
+    std::vector<FileInfo> InstrumentedFileSystem::list_directory(const std::string &path)
+    {
+        Scope scope(*this, FsCall::LIST);
+        return inner_->list_directory(path);
+    }
+
+    std::vector<FileInfo> InstrumentedFileSystem::list_directory_with_stats(const std::string &path,
+                                                                            size_t max_in_flight)
+    {
+        Scope scope(*this, FsCall::LIST);
+        return inner_->list_directory_with_stats(path, max_in_flight);
+    }
+
+    bool InstrumentedFileSystem::is_directory(const std::string &path)
+    {
+        Scope scope(*this, FsCall::STAT);
+        return inner_->is_directory(path);
+    }
+
+    bool InstrumentedFileSystem::exists(const std::string &path)
+    {
+        Scope scope(*this, FsCall::STAT);
+        return inner_->exists(path);
+    }
+
+    FileInfo InstrumentedFileSystem::get_file_info(const std::string &path)
+    {
+        Scope scope(*this, FsCall::STAT);
+        return inner_->get_file_info(path);
+    }
+
+    FileType InstrumentedFileSystem::get_file_type(const std::string &path)
+    {
+        Scope scope(*this, FsCall::STAT);
+        return inner_->get_file_type(path);
+    }
+
+    off_t InstrumentedFileSystem::get_file_size(const std::string &path)
+    {
+        Scope scope(*this, FsCall::STAT);
+        return inner_->get_file_size(path);
+    }
+
+    size_t InstrumentedFileSystem::get_directory_size(const std::string &path, bool recursive)
+    {
+        Scope scope(*this, FsCall::WALK);
+        return inner_->get_directory_size(path, recursive);
+    }
+
+    std::vector<DirectoryUsage> InstrumentedFileSystem::get_directory_usage(const std::string &path, int max_depth,
+                                                                            size_t threads)
+    {
+        Scope scope(*this, FsCall::WALK);
+        return inner_->get_directory_usage(path, max_depth, threads);
+    }
+
+    std::vector<FoundEntry> InstrumentedFileSystem::find(const std::string &path, const FindQuery &query,
+                                                         size_t threads)
+    {
+        Scope scope(*this, FsCall::WALK);
+        return inner_->find(path, query, threads);
+    }
+
+    std::string InstrumentedFileSystem::read_file_content(const std::string &path, size_t max_size)
+    {
+        Scope scope(*this, FsCall::READ);
+        std::string content = inner_->read_file_content(path, max_size);
+        scope.add_bytes(content.size());
+        return content;
+    }
+
+    std::string InstrumentedFileSystem::read_file_content_at_offset(const std::string &path, size_t offset,
+                                                                    size_t length)
+    {
+        Scope scope(*this, FsCall::READ);
+        std::string content = inner_->read_file_content_at_offset(path, offset, length);
+        scope.add_bytes(content.size());
+        return content;
+    }
+
+    size_t InstrumentedFileSystem::read_file_chunks(const std::string &path, size_t offset, size_t length,
+                                                    const ChunkCallback &callback, size_t chunk_size,
+                                                    size_t readahead)
+    {
+        // The time includes the callback, which is where streamed output is formatted
+        Scope scope(*this, FsCall::READ);
+        size_t delivered = inner_->read_file_chunks(path, offset, length, callback, chunk_size, readahead);
+        scope.add_bytes(delivered);
+        return delivered;
+    }
+
+    size_t InstrumentedFileSystem::read_file_range_parallel(const std::string &path, size_t offset, size_t length,
+                                                            const ChunkCallback &callback, size_t request_size,
+                                                            size_t depth)
+    {
+        Scope scope(*this, FsCall::READ);
+        size_t delivered = inner_->read_file_range_parallel(path, offset, length, callback, request_size, depth);
+        scope.add_bytes(delivered);
+        return delivered;
+    }
+
+    FileChecksum InstrumentedFileSystem::checksum_file(const std::string &path, size_t chunk_size, size_t depth)
+    {
+        Scope scope(*this, FsCall::READ);
+        FileChecksum checksum = inner_->checksum_file(path, chunk_size, depth);
+        scope.add_bytes(checksum.size);
+        return checksum;
+    }
+
+    std::string InstrumentedFileSystem::get_file_metadata(const std::string &path)
+    {
+        Scope scope(*this, FsCall::METADATA);
+        return inner_->get_file_metadata(path);
+    }
+
+    bool InstrumentedFileSystem::has_file_metadata(const std::string &path)
+    {
+        Scope scope(*this, FsCall::METADATA);
+        return inner_->has_file_metadata(path);
+    }
+
+    std::shared_ptr<const FileMetadata> InstrumentedFileSystem::read_file_metadata(const std::string &path)
+    {
+        Scope scope(*this, FsCall::METADATA);
+        return inner_->read_file_metadata(path);
+    }
+
+    std::string InstrumentedFileSystem::resolve_path(const std::string &path) const
+    {
+        return inner_->resolve_path(path);
+    }
+
+    std::string InstrumentedFileSystem::get_current_directory()
+    {
+        return inner_->get_current_directory();
+    }
+
+    bool InstrumentedFileSystem::change_directory(const std::string &path)
+    {
+        Scope scope(*this, FsCall::CHDIR);
+        return inner_->change_directory(path);
+    }
+
+} // namespace file_client
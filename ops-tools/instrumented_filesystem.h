@@ -0,0 +1,148 @@
+/**
+ * @file instrumented_filesystem.h
+ * @brief Call accounting decorator for any FileSystemInterface backend
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Forwards every call to the wrapped backend and counts calls, wall time
+ * and payload bytes per call class. FileClient diffs two snapshots around a
+ * command to report what the command cost.
+ */
+
+#pragma once
+
+#include "filesystem_interface.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace file_client
+{
+
+    /**
+     * @enum FsCall
+     * @brief Interface call classes tracked by InstrumentedFileSystem
+     */
+    enum class FsCall
+    {
+        STAT,     ///< exists, is_directory, get_file_info, get_file_type, get_file_size
+        LIST,     ///< list_directory, list_directory_with_stats
+        WALK,     ///< get_directory_size, get_directory_usage, find
+        READ,     ///< read_file_content*, read_file_chunks, read_file_range_parallel, checksum_file
+        METADATA, ///< get_file_metadata, has_file_metadata, read_file_metadata
+        CHDIR,    ///< change_directory
+        COUNT
+    };
+
+    /**
+     * @struct FsCallTotals
+     * @brief Accumulated cost of one call class
+     */
+    struct FsCallTotals
+    {
+        uint64_t calls = 0;
+        uint64_t nanos = 0;
+        uint64_t bytes = 0; ///< Bytes returned to the caller (READ only)
+    };
+
+    /**
+     * @class InstrumentedFileSystem
+     * @brief Decorator that accounts for every call made to a backend
+     *
+     * Counters are relaxed atomics so concurrent commands can share the
+     * decorator. Path processing calls are local and forwarded untimed.
+     */
+    class InstrumentedFileSystem : public FileSystemInterface
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Snapshot = std::array<FsCallTotals, static_cast<size_t>(FsCall::COUNT)>;
+
+        /**
+         * @brief Constructor
+         * @param inner Backend to wrap, owned by the decorator
+         */
+        explicit InstrumentedFileSystem(std::unique_ptr<FileSystemInterface> inner);
+
+        /**
+         * @brief Wrapped backend, for backend-specific controls
+         */
+        FileSystemInterface &inner() { return *inner_; }
+
+        /**
+         * @brief Copy of the counters
+         */
+        Snapshot snapshot() const;
+
+        /**
+         * @brief Zero all counters
+         */
+        void reset();
+
+        static const char *call_name(FsCall call);
+
+        // Directory operations
+        std::vector<FileInfo> list_directory(const std::string &path) override;
+        std::vector<FileInfo> list_directory_with_stats(const std::string &path, size_t max_in_flight) override;
+        bool is_directory(const std::string &path) override;
+        bool exists(const std::string &path) override;
+
+        // File information retrieval
+        FileInfo get_file_info(const std::string &path) override;
+        FileType get_file_type(const std::string &path) override;
+        off_t get_file_size(const std::string &path) override;
+        size_t get_directory_size(const std::string &path, bool recursive) override;
+        std::vector<DirectoryUsage> get_directory_usage(const std::string &path, int max_depth,
+                                                        size_t threads) override;
+        std::vector<FoundEntry> find(const std::string &path, const FindQuery &query, size_t threads) override;
+
+        // File content operations
+        std::string read_file_content(const std::string &path, size_t max_size) override;
+        std::string read_file_content_at_offset(const std::string &path, size_t offset, size_t length) override;
+        size_t read_file_chunks(const std::string &path, size_t offset, size_t length,
+                                const ChunkCallback &callback, size_t chunk_size, size_t readahead) override;
+        size_t read_file_range_parallel(const std::string &path, size_t offset, size_t length,
+                                        const ChunkCallback &callback, size_t request_size, size_t depth) override;
+        FileChecksum checksum_file(const std::string &path, size_t chunk_size, size_t depth) override;
+
+        // File metadata
+        std::string get_file_metadata(const std::string &path) override;
+        bool has_file_metadata(const std::string &path) override;
+        std::shared_ptr<const FileMetadata> read_file_metadata(const std::string &path) override;
+
+        // Path processing
+        std::string resolve_path(const std::string &path) const override;
+        std::string get_current_directory() override;
+        bool change_directory(const std::string &path) override;
+
+    private:
+        struct Counters
+        {
+            std::atomic<uint64_t> calls{0};
+            std::atomic<uint64_t> nanos{0};
+            std::atomic<uint64_t> bytes{0};
+        };
+
+        /** Charges the elapsed time to a call class when the forwarded call returns or throws */
+        class Scope
+        {
+        public:
+            Scope(InstrumentedFileSystem &owner, FsCall call);
+            ~Scope();
+            void add_bytes(uint64_t bytes) { bytes_ += bytes; }
+
+        private:
+            Counters &counters_;
+            Clock::time_point start_;
+            uint64_t bytes_ = 0;
+        };
+
+        std::unique_ptr<FileSystemInterface> inner_;
+        std::array<Counters, static_cast<size_t>(FsCall::COUNT)> counters_;
+    };
+
+} // namespace file_client
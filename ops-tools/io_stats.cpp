@@ -0,0 +1,138 @@
+/**
+ * @file io_stats.cpp
+ * @brief Latency histograms of SDK calls made by the tool implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "io_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace file_client
+{
+
+    size_t LatencyHistogram::bucket(uint64_t us)
+    {
+        if (us < SUB_BUCKETS)
+        {
+            return static_cast<size_t>(us);
+        }
+        size_t msb = 63 - static_cast<size_t>(__builtin_clzll(us));
+        size_t sub = static_cast<size_t>(us >> (msb - 2)) & (SUB_BUCKETS - 1);
+        return std::min((msb - 1) * SUB_BUCKETS + sub, BUCKETS - 1);
+    }
+
+    uint64_t LatencyHistogram::bucket_upper(size_t index)
+    {
+        if (index < SUB_BUCKETS)
+        {
+            return index;
+        }
+        size_t msb = index / SUB_BUCKETS + 1;
+        uint64_t sub = index % SUB_BUCKETS;
+        return ((SUB_BUCKETS + sub + 1) << (msb - 2)) - 1;
+    }
+
+    void LatencyHistogram::record(uint64_t us)
+    {
+        buckets_[bucket(us)].fetch_add(1, std::memory_order_relaxed);
+        sum_us_.fetch_add(us, std::memory_order_relaxed);
+        uint64_t max = max_us_.load(std::memory_order_relaxed);
+        while (us > max && !max_us_.compare_exchange_weak(max, us, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+    {
+        Snapshot snap;
+        for (size_t i = 0; i < BUCKETS; ++i)
+        {
+            snap.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            snap.count += snap.buckets[i];
+        }
+        snap.sum_us = sum_us_.load(std::memory_order_relaxed);
+        snap.max_us = max_us_.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+    void LatencyHistogram::reset()
+    {
+        for (auto &b : buckets_)
+        {
+            b.store(0, std::memory_order_relaxed);
+        }
+        sum_us_.store(0, std::memory_order_relaxed);
+        max_us_.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::Snapshot::percentile(double fraction) const
+    {
+        uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i)
+        {
+            seen += buckets[i];
+            if (seen > 0 && seen >= rank)
+            {
+                return std::min(bucket_upper(i), max_us);
+            }
+        }
+        return max_us;
+    }
+
+    void IoStats::record(IoOp op, Clock::time_point start, uint64_t bytes)
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+        histograms_[static_cast<size_t>(op)].record(us > 0 ? static_cast<uint64_t>(us) : 0);
+        if (bytes != 0)
+        {
+            bytes_[static_cast<size_t>(op)].fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    LatencyHistogram::Snapshot IoStats::snapshot(IoOp op) const
+    {
+        return histograms_[static_cast<size_t>(op)].snapshot();
+    }
+
+    void IoStats::reset()
+    {
+        for (auto &histogram : histograms_)
+        {
+            histogram.reset();
+        }
+        for (auto &bytes : bytes_)
+        {
+            bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t IoStats::bytes(IoOp op) const
+    {
+        return bytes_[static_cast<size_t>(op)].load(std::memory_order_relaxed);
+    }
+
+    const char *IoStats::op_name(IoOp op)
+    {
+        switch (op)
+        {
+        case IoOp::READ:
+            return "read";
+        case IoOp::STAT:
+            return "stat";
+        case IoOp::OPEN:
+            return "open";
+        case IoOp::OPENDIR:
+            return "opendir";
+        case IoOp::META:
+            return "meta";
+        default:
+            return "unknown";
+        }
+    }
+
+} // namespace file_client
@@ -0,0 +1,118 @@
+/**
+ * @file io_stats.h
+ * @brief Latency histograms of SDK calls made by the tool
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Uses the same log-linear microsecond buckets as the InnoDB I/O latency
+ * histograms in os0file.cc, so tail latencies seen by the tool and by the
+ * server can be compared directly.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace file_client
+{
+
+    /**
+     * @class LatencyHistogram
+     * @brief Lock-free log-linear latency histogram in microseconds
+     *
+     * Values below SUB_BUCKETS are exact, every higher power of two is split
+     * into SUB_BUCKETS equal buckets.
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr size_t SUB_BUCKETS = 4;              ///< Linear buckets per power of two
+        static constexpr size_t BUCKETS = 33 * SUB_BUCKETS;   ///< Last bucket also holds everything above 2^33 us
+
+        /**
+         * @struct Snapshot
+         * @brief Point-in-time copy of a histogram
+         */
+        struct Snapshot
+        {
+            std::array<uint64_t, BUCKETS> buckets{};
+            uint64_t count = 0;
+            uint64_t sum_us = 0;
+            uint64_t max_us = 0;
+
+            /**
+             * @brief Latency below which the given fraction of calls fall
+             * @param fraction Quantile in (0, 1]
+             * @return Upper bound of the matching bucket in microseconds
+             */
+            uint64_t percentile(double fraction) const;
+
+            double average() const { return count == 0 ? 0.0 : static_cast<double>(sum_us) / count; }
+        };
+
+        void record(uint64_t us);
+        Snapshot snapshot() const;
+        void reset();
+
+        static size_t bucket(uint64_t us);
+        static uint64_t bucket_upper(size_t index);
+
+    private:
+        std::array<std::atomic<uint64_t>, BUCKETS> buckets_{};
+        std::atomic<uint64_t> sum_us_{0};
+        std::atomic<uint64_t> max_us_{0};
+    };
+
+    /**
+     * @enum IoOp
+     * @brief SDK call classes tracked by IoStats
+     */
+    enum class IoOp
+    {
+        READ,    ///< pread
+        STAT,    ///< stat that missed the metadata cache
+        OPEN,    ///< open that missed the descriptor pool
+        OPENDIR, ///< opendir plus readdir of the whole directory
+        META,    ///< get_ibd_meta_info / get_redo_meta_info that missed the metadata cache
+        COUNT
+    };
+
+    /**
+     * @class IoStats
+     * @brief One latency histogram per SDK call class
+     */
+    class IoStats
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Record a finished call
+         * @param op Call class
+         * @param start Time the call was issued
+         * @param bytes Payload moved by the call (pread only)
+         */
+        void record(IoOp op, Clock::time_point start, uint64_t bytes = 0);
+
+        LatencyHistogram::Snapshot snapshot(IoOp op) const;
+
+        /**
+         * @brief Total payload recorded for a call class
+         */
+        uint64_t bytes(IoOp op) const;
+
+        void reset();
+
+        static const char *op_name(IoOp op);
+
+    private:
+        std::array<LatencyHistogram, static_cast<size_t>(IoOp::COUNT)> histograms_;
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(IoOp::COUNT)> bytes_{};
+    };
+
+} // namespace file_client
@@ -0,0 +1,131 @@
+/**
+ * @file local_file.cpp
+ * @brief Read access to files on the local file system implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "local_file.h"
+#include "chunked_checksum.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace file_client
+{
+namespace local_file
+{
+
+    namespace
+    {
+        /** Descriptor closed on scope exit */
+        class Fd
+        {
+        public:
+            explicit Fd(const std::string &path) : fd_(::open(path.c_str(), O_RDONLY))
+            {
+                if (fd_ < 0)
+                {
+                    throw std::runtime_error("Cannot open local file: " + path + ": " + std::strerror(errno));
+                }
+            }
+            ~Fd() { ::close(fd_); }
+            Fd(const Fd &) = delete;
+            Fd &operator=(const Fd &) = delete;
+
+            int get() const { return fd_; }
+
+        private:
+            int fd_;
+        };
+
+        size_t pread_fully(int fd, char *buffer, size_t length, uint64_t offset, const std::string &path)
+        {
+            size_t filled = 0;
+            while (filled < length)
+            {
+                ssize_t n = ::pread(fd, buffer + filled, length - filled, static_cast<off_t>(offset + filled));
+                if (n < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (n < 0)
+                {
+                    throw std::runtime_error("pread failed for local file: " + path);
+                }
+                if (n == 0)
+                    break; // EOF
+                filled += n;
+            }
+            return filled;
+        }
+
+        FileType mode_to_file_type(mode_t mode)
+        {
+            if (S_ISREG(mode))
+                return FileType::REGULAR_FILE;
+            if (S_ISDIR(mode))
+                return FileType::DIRECTORY;
+            if (S_ISBLK(mode))
+                return FileType::BLOCK_DEVICE;
+            if (S_ISCHR(mode))
+                return FileType::CHARACTER_DEVICE;
+            if (S_ISFIFO(mode))
+                return FileType::FIFO;
+            if (S_ISSOCK(mode))
+                return FileType::SOCKET;
+            return FileType::UNKNOWN;
+        }
+    }
+
+    bool strip_prefix(const std::string &operand, std::string &path)
+    {
+        const size_t prefix_length = std::strlen(PREFIX);
+        if (operand.compare(0, prefix_length, PREFIX) != 0)
+        {
+            return false;
+        }
+        path = operand.substr(prefix_length);
+        return true;
+    }
+
+    bool get_file_type(const std::string &path, FileType &type)
+    {
+        struct stat st;
+        if (::stat(path.c_str(), &st) != 0)
+        {
+            return false;
+        }
+        type = mode_to_file_type(st.st_mode);
+        return true;
+    }
+
+    std::string read_at(const std::string &path, uint64_t offset, size_t length)
+    {
+        Fd fd(path);
+        std::string content(length, '\0');
+        content.resize(pread_fully(fd.get(), content.data(), length, offset, path));
+        return content;
+    }
+
+    FileChecksum checksum(const std::string &path, size_t chunk_size, size_t depth)
+    {
+        Fd fd(path);
+        struct stat st;
+        if (::fstat(fd.get(), &st) != 0)
+        {
+            throw std::runtime_error("Failed to get file size: " + path);
+        }
+        return checksum_chunks(static_cast<uint64_t>(st.st_size), chunk_size,
+                               depth != 0 ? depth : FileSystemInterface::DEFAULT_IO_DEPTH, path,
+                               [&](char *buffer, size_t length, uint64_t offset)
+                               { return pread_fully(fd.get(), buffer, length, offset, path); });
+    }
+
+} // namespace local_file
+} // namespace file_client
@@ -0,0 +1,64 @@
+/**
+ * @file local_file.h
+ * @brief Read access to files on the local file system
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Lets commands compare an SDK-stored file with a local copy, e.g. a
+ * tablespace with its backup, without copying either side. Local operands
+ * are written as "local:<path>" and bypass the SDK root entirely.
+ */
+
+#pragma once
+
+#include "filesystem_interface.h"
+
+#include <cstdint>
+#include <string>
+
+namespace file_client
+{
+namespace local_file
+{
+
+    constexpr const char *PREFIX = "local:"; ///< Operand prefix selecting a local file
+
+    /**
+     * @brief Strip the local prefix from an operand
+     * @param operand Command operand
+     * @param path Receives the local path when the operand has the prefix
+     * @return true if the operand names a local file
+     */
+    bool strip_prefix(const std::string &operand, std::string &path);
+
+    /**
+     * @brief Type of a local file, following symbolic links
+     * @param path Local path
+     * @param type Receives the file type
+     * @return false if the file does not exist
+     */
+    bool get_file_type(const std::string &path, FileType &type);
+
+    /**
+     * @brief Read a range of a local file with pread
+     * @param path Local path
+     * @param offset Starting read offset
+     * @param length Read length, the result is shorter at the end of the file
+     * @return File content
+     * @throw std::runtime_error if the file cannot be opened or read
+     */
+    std::string read_at(const std::string &path, uint64_t offset, size_t length);
+
+    /**
+     * @brief Checksum a local file with the same chunking and CRC32C as checksum_file
+     * @param path Local path
+     * @param chunk_size Chunk size in bytes (rounded up to the I/O alignment)
+     * @param depth Chunks in flight, 0 uses FileSystemInterface::DEFAULT_IO_DEPTH
+     * @return Per-chunk and whole-file CRC32C, comparable chunk by chunk with an SDK file's
+     * @throw std::runtime_error if the file cannot be opened or read
+     */
+    FileChecksum checksum(const std::string &path, size_t chunk_size, size_t depth = 0);
+
+} // namespace local_file
+} // namespace file_client
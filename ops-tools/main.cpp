@@ -14,10 +14,14 @@
 #include <exception>
 #include <string>
 #include <fstream>
+#include <sstream>
+#include <vector>
+#include <unistd.h>
 #include <glog/logging.h>
 
 #include "file_client.h"
 #include "spdb_sdk_filesystem.h"
+#include "fd_output_buffer.h"
 
 /**
  * @brief Program main entry point, initializes SPDB SDK file system, creates file client and starts interactive interface.
@@ -25,12 +29,19 @@
  * @param argv Command line argument array
  * @return int Program exit code, 0 for success, 1 for failure
  * @note Program supports one optional command line parameter to specify root directory path
+ * @note Batch mode runs commands from -c, -f or a non-terminal stdin and writes results to stdout,
+ *       the exit code is 1 if any command failed
  * @example
- *   ./ops_tools /mysql/data    # Specify root directory
- *   ./ops_tools                # Use default root directory /mysql/data
+ *   ./ops_tools /mysql/data                          # Specify root directory
+ *   ./ops_tools                                      # Use default root directory /mysql/data
+ *   ./ops_tools -c "stat a.ibd; meta #ib_redo1" /mysql/data
+ *   ./ops_tools -f checks.txt /mysql/data            # One command per line
+ *   cat checks.txt | ./ops_tools /mysql/data
  */
 int main(int argc, char *argv[])
 {
+    // Keep the real stdout for batch results before the SDK output is silenced
+    int stdout_fd = dup(STDOUT_FILENO);
 
     FILE* devnull = fopen("/dev/null", "w");
     dup2(fileno(devnull), fileno(stdout));
@@ -47,17 +58,61 @@ int main(int argc, char *argv[])
     try
     {
         std::string root_directory = DEFAULT_ROOT_DIRECTORY;
+        std::string script;
+        bool batch = false;
         // Parse command line arguments
-        if (argc > 1)
+        for (int i = 1; i < argc; ++i)
         {
-            root_directory = argv[1];
-            // Simple parameter validation
-            if (root_directory.empty())
+            std::string arg = argv[i];
+            if ((arg == "-c" || arg == "-f") && i + 1 < argc)
             {
-                std::cerr << "Error: Root directory cannot be empty" << std::endl;
-                return 1;
+                batch = true;
+                if (arg == "-c")
+                {
+                    script += std::string(argv[++i]) + "\n";
+                    continue;
+                }
+                std::ifstream file(argv[++i]);
+                if (!file)
+                {
+                    std::cerr << "Error: Cannot open script: " << argv[i] << std::endl;
+                    return 1;
+                }
+                std::ostringstream content;
+                content << file.rdbuf();
+                script += content.str() + "\n";
             }
+            else
+            {
+                root_directory = arg;
+            }
+        }
+        // Simple parameter validation
+        if (root_directory.empty())
+        {
+            std::cerr << "Error: Root directory cannot be empty" << std::endl;
+            return 1;
+        }
+        // Commands piped on stdin
+        if (!batch && !isatty(STDIN_FILENO))
+        {
+            std::ostringstream content;
+            content << std::cin.rdbuf();
+            script = content.str();
+            batch = true;
         }
+
+        if (batch)
+        {
+            auto filesystem = std::make_unique<file_client::SPDB_SDKFileSystem>(root_directory);
+            file_client::FileClient client(std::move(filesystem));
+            file_client::FdOutputBuffer buffer(stdout_fd);
+            std::ostream out(&buffer);
+            client.set_output_stream(out);
+            size_t failed = client.run_batch(file_client::FileClient::split_script(script));
+            return failed == 0 ? 0 : 1;
+        }
+
         // Display startup information
         std::cerr << "Starting SPDB SDK File Client..." << std::endl;
         std::cerr << "Root directory: " << root_directory << std::endl;
@@ -70,7 +125,7 @@ int main(int argc, char *argv[])
     {
         std::cerr << "Fatal Error: " << e.what() << std::endl;
         std::cerr << "Usage: " << (argc > 0 ? argv[0] : "ops_tools")
-                  << " [root_directory]" << std::endl;
+                  << " [-c \"cmd; cmd\"] [-f script] [root_directory]" << std::endl;
         std::cerr << "Example: " << (argc > 0 ? argv[0] : "ops_tools")
                   << " /mysql/data" << std::endl;
         return 1;
@@ -0,0 +1,72 @@
+/**
+ * @file metadata_cache.cpp
+ * @brief SDK file metadata cache implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "metadata_cache.h"
+
+namespace file_client
+{
+
+    MetadataCache::MetadataCache(std::chrono::milliseconds ttl)
+        : ttl_(ttl)
+    {
+    }
+
+    std::shared_ptr<const FileMetadata> MetadataCache::lookup(const std::string &key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.expires <= Clock::now())
+        {
+            if (it != entries_.end())
+            {
+                entries_.erase(it);
+            }
+            counters_.misses++;
+            return nullptr;
+        }
+        counters_.hits++;
+        return it->second.metadata;
+    }
+
+    void MetadataCache::store(const std::string &key, std::shared_ptr<const FileMetadata> metadata)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ttl_.count() <= 0)
+        {
+            return;
+        }
+        Entry &entry = entries_[key];
+        entry.metadata = std::move(metadata);
+        entry.expires = Clock::now() + ttl_;
+    }
+
+    void MetadataCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+    void MetadataCache::set_ttl(std::chrono::milliseconds ttl)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ttl_ = ttl;
+        if (ttl_.count() <= 0)
+        {
+            entries_.clear();
+        }
+    }
+
+    MetadataCache::Counters MetadataCache::counters() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Counters result = counters_;
+        result.entries = entries_.size();
+        return result;
+    }
+
+} // namespace file_client
@@ -0,0 +1,92 @@
+/**
+ * @file metadata_cache.h
+ * @brief SDK file metadata cache with TTL
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Caches decoded get_ibd_meta_info / get_redo_meta_info results keyed by
+ * resolved full path, so a bulk meta scan followed by a narrower one does not
+ * go back to the SDK for every tablespace.
+ */
+
+#pragma once
+
+#include "filesystem_interface.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace file_client
+{
+
+    /**
+     * @class MetadataCache
+     * @brief Thread-safe TTL cache of decoded file metadata
+     *
+     * Entries are immutable and shared, a lookup hands out the cached pointer
+     * without copying the version list. Failed fetches are not cached.
+     */
+    class MetadataCache
+    {
+    public:
+        /**
+         * @struct Counters
+         * @brief Cache effectiveness counters
+         */
+        struct Counters
+        {
+            uint64_t hits = 0;   ///< Lookups answered from the cache
+            uint64_t misses = 0; ///< Lookups that required an SDK call
+            size_t entries = 0;  ///< Current number of cached paths
+        };
+
+        static constexpr std::chrono::milliseconds DEFAULT_TTL{2000}; ///< Default entry lifetime
+
+        explicit MetadataCache(std::chrono::milliseconds ttl = DEFAULT_TTL);
+
+        /**
+         * @brief Look up cached metadata
+         * @param key Resolved full path
+         * @return Cached metadata, nullptr if the caller must fetch it
+         */
+        std::shared_ptr<const FileMetadata> lookup(const std::string &key);
+
+        /**
+         * @brief Store fetched metadata
+         * @param key Resolved full path
+         * @param metadata Decoded metadata
+         */
+        void store(const std::string &key, std::shared_ptr<const FileMetadata> metadata);
+
+        /**
+         * @brief Drop all cached entries
+         */
+        void clear();
+
+        /**
+         * @brief Set entry lifetime, 0 disables caching
+         */
+        void set_ttl(std::chrono::milliseconds ttl);
+
+        Counters counters() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Entry
+        {
+            std::shared_ptr<const FileMetadata> metadata; ///< Cached metadata
+            Clock::time_point expires;                     ///< Expiry time
+        };
+
+        mutable std::mutex mutex_;
+        std::unordered_map<std::string, Entry> entries_;
+        std::chrono::milliseconds ttl_;
+        Counters counters_;
+    };
+
+} // namespace file_client
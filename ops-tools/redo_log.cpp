@@ -0,0 +1,156 @@
+/**
+ * @file redo_log.cpp
+ * @brief InnoDB redo log file scanning implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "redo_log.h"
+#include "innodb_page.h"
+#include "crc32c.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace file_client
+{
+namespace innodb
+{
+
+    namespace
+    {
+        bool block_checksum_ok(const unsigned char *block)
+        {
+            return read_be32(block + LOG_BLOCK_CHECKSUM) == crc32c(block, LOG_BLOCK_CHECKSUM);
+        }
+
+        bool block_is_zero(const unsigned char *block)
+        {
+            static const unsigned char zero[OS_FILE_LOG_BLOCK_SIZE] = {};
+            return std::memcmp(block, zero, OS_FILE_LOG_BLOCK_SIZE) == 0;
+        }
+    }
+
+    RedoFileScanner::RedoFileScanner(RedoFileScan &result)
+        : result_(result)
+    {
+    }
+
+    void RedoFileScanner::consume(const unsigned char *data, size_t size, size_t offset)
+    {
+        for (size_t pos = 0; pos + OS_FILE_LOG_BLOCK_SIZE <= size; pos += OS_FILE_LOG_BLOCK_SIZE)
+        {
+            size_t block_offset = offset + pos;
+            if (block_offset < LOG_FILE_HDR_SIZE)
+            {
+                parse_header_block(data + pos, block_offset);
+            }
+            else
+            {
+                parse_data_block(data + pos, block_offset);
+            }
+        }
+        result_.file_size = std::max<uint64_t>(result_.file_size, offset + size);
+    }
+
+    void RedoFileScanner::finish()
+    {
+        // Whatever failed after the last valid block is the unused or recycled tail
+        result_.stale_blocks += pending_torn_ + pending_gap_;
+        pending_torn_ = pending_gap_ = 0;
+        if (in_sequence_)
+        {
+            result_.recovery_end_lsn = result_.last_valid_lsn;
+        }
+    }
+
+    void RedoFileScanner::parse_header_block(const unsigned char *block, size_t offset)
+    {
+        bool valid = block_checksum_ok(block);
+        if (offset == 0)
+        {
+            result_.header_valid = valid;
+            result_.format = read_be32(block + LOG_HEADER_FORMAT);
+            result_.start_lsn = read_be64(block + LOG_HEADER_START_LSN);
+            const char *creator = reinterpret_cast<const char *>(block + LOG_HEADER_CREATOR);
+            result_.creator.assign(creator, strnlen(creator, LOG_HEADER_CREATOR_LEN));
+            result_.recovery_end_lsn = result_.start_lsn;
+            result_.last_valid_lsn = result_.start_lsn;
+        }
+        else if (offset == LOG_CHECKPOINT_1 || offset == LOG_CHECKPOINT_2)
+        {
+            result_.checkpoint_lsn[offset == LOG_CHECKPOINT_1 ? 0 : 1] =
+                valid ? read_be64(block + LOG_CHECKPOINT_LSN) : 0;
+        }
+    }
+
+    void RedoFileScanner::parse_data_block(const unsigned char *block, size_t offset)
+    {
+        result_.data_blocks++;
+        uint64_t lsn = result_.start_lsn + (offset - LOG_FILE_HDR_SIZE);
+
+        auto end_sequence = [&](uint64_t end_lsn)
+        {
+            if (in_sequence_)
+            {
+                result_.recovery_end_lsn = end_lsn;
+                in_sequence_ = false;
+            }
+        };
+        auto note_problem = [&]()
+        {
+            if (pending_offset_ == UINT64_MAX)
+            {
+                pending_offset_ = offset;
+            }
+        };
+
+        if (block_is_zero(block))
+        {
+            end_sequence(lsn);
+            pending_gap_++;
+            note_problem();
+            return;
+        }
+        if (!block_checksum_ok(block))
+        {
+            end_sequence(lsn);
+            pending_torn_++;
+            note_problem();
+            return;
+        }
+        uint32_t hdr_no = read_be32(block + LOG_BLOCK_HDR_NO) & ~LOG_BLOCK_FLUSH_BIT_MASK;
+        if (hdr_no != log_block_convert_lsn_to_no(lsn))
+        {
+            end_sequence(lsn);
+            pending_gap_++;
+            note_problem();
+            return;
+        }
+
+        // Valid, in-sequence block: earlier failures were holes inside the written data
+        result_.valid_blocks++;
+        if (pending_torn_ + pending_gap_ > 0)
+        {
+            result_.torn_blocks += pending_torn_;
+            result_.gap_blocks += pending_gap_;
+            result_.first_hole_offset = std::min<uint64_t>(result_.first_hole_offset, pending_offset_);
+            pending_torn_ = pending_gap_ = 0;
+        }
+        pending_offset_ = UINT64_MAX;
+
+        uint16_t data_len = read_be16(block + LOG_BLOCK_HDR_DATA_LEN);
+        if (data_len < OS_FILE_LOG_BLOCK_SIZE)
+        {
+            // Partially filled block is where the writer stopped
+            uint64_t end_lsn = lsn + std::max<uint16_t>(data_len, LOG_BLOCK_HDR_SIZE);
+            result_.last_valid_lsn = end_lsn;
+            end_sequence(end_lsn);
+            return;
+        }
+        result_.last_valid_lsn = lsn + OS_FILE_LOG_BLOCK_SIZE;
+    }
+
+} // namespace innodb
+} // namespace file_client
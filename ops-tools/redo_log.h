@@ -0,0 +1,117 @@
+/**
+ * @file redo_log.h
+ * @brief InnoDB redo log file scanning
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Parses the #ib_redo* file header, checkpoint blocks and 512-byte log blocks
+ * (layout of log0constants.h, MySQL 8.0.30+) and tracks the LSN range that
+ * recovery would see, plus torn and out-of-sequence blocks.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace file_client
+{
+namespace innodb
+{
+
+    /** @name Redo log layout
+     * @{ */
+    constexpr size_t OS_FILE_LOG_BLOCK_SIZE = 512;         ///< Log block size
+    constexpr size_t LOG_FILE_HDR_SIZE = 4 * OS_FILE_LOG_BLOCK_SIZE; ///< Header area at file start
+    constexpr size_t LOG_HEADER_FORMAT = 0;                ///< Format version (4 bytes)
+    constexpr size_t LOG_HEADER_START_LSN = 8;             ///< LSN of the first data byte (8 bytes)
+    constexpr size_t LOG_HEADER_CREATOR = 16;              ///< Creator string
+    constexpr size_t LOG_HEADER_CREATOR_LEN = 32;          ///< Creator string length
+    constexpr size_t LOG_CHECKPOINT_1 = OS_FILE_LOG_BLOCK_SIZE;     ///< First checkpoint block
+    constexpr size_t LOG_CHECKPOINT_2 = 3 * OS_FILE_LOG_BLOCK_SIZE; ///< Second checkpoint block
+    constexpr size_t LOG_CHECKPOINT_LSN = 8;               ///< Checkpoint LSN inside its block (8 bytes)
+    constexpr size_t LOG_BLOCK_HDR_NO = 0;                 ///< Block number (4 bytes, top bit is the flush bit)
+    constexpr size_t LOG_BLOCK_HDR_DATA_LEN = 4;           ///< Bytes used in the block (2 bytes)
+    constexpr size_t LOG_BLOCK_FIRST_REC_GROUP = 6;        ///< Offset of first record group (2 bytes)
+    constexpr size_t LOG_BLOCK_HDR_SIZE = 12;              ///< Block header size
+    constexpr size_t LOG_BLOCK_CHECKSUM = 508;             ///< Block checksum offset (4 bytes)
+    constexpr uint32_t LOG_BLOCK_FLUSH_BIT_MASK = 0x80000000UL;
+    /** @} */
+
+    /**
+     * @brief Block number a block starting at lsn must carry (log_block_convert_lsn_to_no)
+     */
+    inline uint32_t log_block_convert_lsn_to_no(uint64_t lsn)
+    {
+        return static_cast<uint32_t>((lsn / OS_FILE_LOG_BLOCK_SIZE) & 0x3FFFFFFFUL) + 1;
+    }
+
+    /**
+     * @struct RedoFileScan
+     * @brief Scan result of one redo log file
+     */
+    struct RedoFileScan
+    {
+        std::string name;             ///< File name as displayed
+        uint64_t file_size = 0;       ///< Bytes scanned
+        bool header_valid = false;    ///< Header block checksum matches
+        uint32_t format = 0;          ///< LOG_HEADER_FORMAT
+        uint64_t start_lsn = 0;       ///< LSN of the first data block
+        std::string creator;          ///< LOG_HEADER_CREATOR
+        uint64_t checkpoint_lsn[2] = {0, 0};        ///< Checkpoint LSNs (0 if invalid)
+        uint64_t recovery_end_lsn = 0; ///< End of the contiguous valid block sequence
+        uint64_t last_valid_lsn = 0;   ///< End of the last valid in-sequence block anywhere in the file
+        uint64_t data_blocks = 0;      ///< Data blocks examined
+        uint64_t valid_blocks = 0;     ///< Blocks with valid checksum and expected number
+        uint64_t torn_blocks = 0;      ///< Checksum mismatches followed by valid data (holes)
+        uint64_t gap_blocks = 0;       ///< Out-of-sequence blocks followed by valid data (holes)
+        uint64_t stale_blocks = 0;     ///< Invalid or old blocks after the last valid block
+        uint64_t first_hole_offset = UINT64_MAX; ///< File offset of the first torn/gap block inside the data
+        std::string error;             ///< Read error, empty on success
+
+        /**
+         * @brief LSN just past the capacity of this file
+         */
+        uint64_t capacity_end_lsn() const
+        {
+            return file_size > LOG_FILE_HDR_SIZE ? start_lsn + file_size - LOG_FILE_HDR_SIZE : start_lsn;
+        }
+    };
+
+    /**
+     * @class RedoFileScanner
+     * @brief Incremental scanner fed with consecutive file chunks
+     */
+    class RedoFileScanner
+    {
+    public:
+        explicit RedoFileScanner(RedoFileScan &result);
+
+        /**
+         * @brief Consume the next chunk of the file
+         * @param data Chunk bytes
+         * @param size Chunk size
+         * @param offset File offset of the chunk, chunks must arrive in order and block aligned
+         */
+        void consume(const unsigned char *data, size_t size, size_t offset);
+
+        /**
+         * @brief Finish the scan after the last chunk
+         */
+        void finish();
+
+    private:
+        void parse_header_block(const unsigned char *block, size_t offset);
+        void parse_data_block(const unsigned char *block, size_t offset);
+
+        RedoFileScan &result_;
+        bool in_sequence_ = true;   ///< Still inside the contiguous valid region
+        uint64_t pending_torn_ = 0; ///< Torn blocks since the last valid block
+        uint64_t pending_gap_ = 0;  ///< Out-of-sequence blocks since the last valid block
+        uint64_t pending_offset_ = UINT64_MAX; ///< First pending problem offset
+    };
+
+} // namespace innodb
+} // namespace file_client
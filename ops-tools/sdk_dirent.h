@@ -0,0 +1,80 @@
+/**
+ * @file sdk_dirent.h
+ * @brief Entry type reported by SDK readdir, when the SDK provides it
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Some SDK releases carry d_type in spdb::sdk::file::dirent and some do not.
+ * The field is detected at compile time, the same way os0file.cc does for the
+ * server's directory walker, so listings skip the per-entry stat whenever the
+ * type is already known.
+ */
+
+#pragma once
+
+#include "filesystem_interface.h"
+
+#include <dirent.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace file_client
+{
+
+    /** Detects whether the SDK dirent reports the entry type in d_type */
+    template <typename T, typename = void>
+    struct sdk_dirent_has_type : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct sdk_dirent_has_type<T, std::void_t<decltype(std::declval<const T &>().d_type)>> : std::true_type
+    {
+    };
+
+    /**
+     * @struct SdkDirEntry
+     * @brief One entry of an SDK directory listing
+     */
+    struct SdkDirEntry
+    {
+        std::string name; ///< Entry name
+        FileType type;    ///< Type reported by readdir, UNKNOWN if a stat is needed to tell
+    };
+
+    /**
+     * @brief Type of an SDK directory entry as reported by readdir
+     * @param entry Directory entry
+     * @return UNKNOWN if the SDK does not report the type, or for symbolic links, whose
+     *         target type only a stat can tell
+     */
+    template <typename Dirent>
+    FileType sdk_dirent_type(const Dirent &entry)
+    {
+        if constexpr (sdk_dirent_has_type<Dirent>::value)
+        {
+            switch (entry.d_type)
+            {
+            case DT_REG:
+                return FileType::REGULAR_FILE;
+            case DT_DIR:
+                return FileType::DIRECTORY;
+            case DT_BLK:
+                return FileType::BLOCK_DEVICE;
+            case DT_CHR:
+                return FileType::CHARACTER_DEVICE;
+            case DT_FIFO:
+                return FileType::FIFO;
+            case DT_SOCK:
+                return FileType::SOCKET;
+            default:
+                break;
+            }
+        }
+        (void)entry;
+        return FileType::UNKNOWN;
+    }
+
+} // namespace file_client
@@ -10,6 +10,9 @@
  */
 
 #include "spdb_sdk_filesystem.h"
+#include "aligned_buffer.h"
+#include "work_stealing_pool.h"
+#include "chunked_checksum.h"
 
 #include <stdexcept>
 #include <string>
@@ -19,6 +22,13 @@
 #include <sstream>
 #include <fcntl.h>
 #include <iostream>
+#include <atomic>
+#include <thread>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <fnmatch.h>
 
 #include <spdb-sdk/sdk/sdk.h>
 #include <spdb-sdk/file/file_io.h>
@@ -31,7 +41,8 @@ namespace file_client
 {
 
     SPDB_SDKFileSystem::SPDB_SDKFileSystem(const std::string &root_path)
-        : current_path_("/")
+        : current_path_("/"), fd_pool_(FdPool::DEFAULT_CAPACITY, &io_stats_),
+          stat_pool_(std::make_unique<WorkStealingPool>(DEFAULT_STAT_CONCURRENCY - 1))
     {
         spdb::sdk::initialize("/etc/spdb/sdk_default_config.toml");
 
@@ -68,6 +79,7 @@ namespace file_client
         {
             root_path_ += '/';
         }
+        update_current_system_path();
 
         //test_initialize();
         // test_ibd_meta();
@@ -159,39 +171,126 @@ namespace file_client
 
     std::vector<FileInfo> SPDB_SDKFileSystem::list_directory(const std::string &path)
     {
-        std::vector<FileInfo> files;
-        std::string full_path = get_full_path(path);
+        return list_entries(path, stat_concurrency_, false);
+    }
+
+    std::vector<FileInfo> SPDB_SDKFileSystem::list_directory_with_stats(const std::string &path,
+                                                                        size_t max_in_flight)
+    {
+        return list_entries(path, max_in_flight, true);
+    }
 
+    bool SPDB_SDKFileSystem::read_directory(const std::string &full_path, std::vector<SdkDirEntry> &entries) const
+    {
+        auto start = IoStats::Clock::now();
         spdb::sdk::file::DIR *dir = spdb::sdk::file::opendir(full_path.c_str());
         if (!dir)
         {
-            return files;
+            return false;
         }
-
         struct spdb::sdk::file::dirent *entry;
         while ((entry = spdb::sdk::file::readdir(dir)) != nullptr)
         {
+            std::string name = entry->d_name;
             // Skip . and ..
-            if (entry->d_name == "." || entry->d_name == "..")
+            if (name == "." || name == "..")
             {
                 continue;
             }
+            entries.push_back({std::move(name), sdk_dirent_type(*entry)});
+        }
+        spdb::sdk::file::closedir(dir);
+        io_stats_.record(IoOp::OPENDIR, start);
+        return true;
+    }
 
-            std::string relative_file_path = (path.empty() || path == ".") ? entry->d_name : path + "/" + entry->d_name;
-            try
+    std::vector<FileInfo> SPDB_SDKFileSystem::list_entries(const std::string &path, size_t max_in_flight,
+                                                           bool stat_typed)
+    {
+        std::vector<FileInfo> files;
+        std::string full_path = get_full_path(path);
+
+        std::vector<SdkDirEntry> entries;
+        if (!read_directory(full_path, entries) || entries.empty())
+        {
+            return files;
+        }
+
+        // Entries whose type readdir reported need no stat unless the caller wants sizes and times
+        std::vector<FileInfo> infos(entries.size());
+        std::vector<char> valid(entries.size(), 0);
+        std::vector<std::string> names;
+        std::vector<size_t> slots;
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (!stat_typed && entries[i].type != FileType::UNKNOWN)
             {
-                FileInfo info = get_file_info(relative_file_path);
-                info.name = entry->d_name;
-                files.push_back(info);
+                infos[i].name = std::move(entries[i].name);
+                infos[i].type = entries[i].type;
+                infos[i].size = 0;
+                infos[i].mode = 0;
+                infos[i].mtime = infos[i].atime = infos[i].ctime = 0;
+                valid[i] = 1;
+                continue;
             }
-            catch (...)
+            names.push_back(std::move(entries[i].name));
+            slots.push_back(i);
+        }
+
+        // Resolve the remaining stats with a bounded number of requests in flight, the calling
+        // thread and up to max_in_flight - 1 stat_pool_ workers claim names from a shared index
+        std::atomic<size_t> next{0};
+        auto worker = [&]()
+        {
+            for (size_t i = next.fetch_add(1); i < names.size(); i = next.fetch_add(1))
             {
+                struct stat st;
+                std::string entry_path = join_path(full_path, names[i]);
+                if (timed_stat(entry_path, st) == 0)
+                {
+                    stat_cache_.store(entry_path, &st);
+                    infos[slots[i]] = make_file_info(names[i], st);
+                    valid[slots[i]] = 1;
+                }
                 // Ignore files that cannot be accessed
-                continue;
             }
+        };
+
+        if (!names.empty())
+        {
+            size_t helpers =
+                std::min({std::max<size_t>(max_in_flight, 1), names.size(), stat_pool_->thread_count() + 1}) - 1;
+
+            // Wait only for this listing's tasks, the pool is shared by concurrent listings
+            std::mutex done_mutex;
+            std::condition_variable done_cv;
+            size_t running = helpers;
+            for (size_t t = 0; t < helpers; ++t)
+            {
+                stat_pool_->submit([&]
+                                   {
+                                       worker();
+                                       std::lock_guard<std::mutex> lock(done_mutex);
+                                       if (--running == 0)
+                                       {
+                                           done_cv.notify_one();
+                                       }
+                                   });
+            }
+            worker();
+            std::unique_lock<std::mutex> lock(done_mutex);
+            done_cv.wait(lock, [&]
+                         { return running == 0; });
         }
 
-        spdb::sdk::file::closedir(dir);
+        files.reserve(infos.size());
+        for (size_t i = 0; i < infos.size(); ++i)
+        {
+            if (valid[i])
+            {
+                files.push_back(std::move(infos[i]));
+            }
+        }
 
         // Sort by filename
         std::sort(files.begin(), files.end(),
@@ -205,29 +304,31 @@ namespace file_client
 
     bool SPDB_SDKFileSystem::is_directory(const std::string &path)
     {
-        std::string full_path = get_full_path(path);
         struct stat st;
-        return spdb::sdk::file::stat(full_path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+        return cached_stat(get_full_path(path), st) && S_ISDIR(st.st_mode);
     }
 
     bool SPDB_SDKFileSystem::exists(const std::string &path)
     {
-        std::string full_path = get_full_path(path);
         struct stat st;
-        return spdb::sdk::file::stat(full_path.c_str(), &st) == 0;
+        return cached_stat(get_full_path(path), st);
     }
 
     FileInfo SPDB_SDKFileSystem::get_file_info(const std::string &path)
     {
-        std::string full_path = get_full_path(path);
         struct stat st;
-        if (spdb::sdk::file::stat(full_path.c_str(), &st) != 0)
+        if (!cached_stat(get_full_path(path), st))
         {
             throw std::runtime_error("Cannot get file info: " + path);
         }
 
+        return make_file_info(path.substr(path.find_last_of('/') + 1), st);
+    }
+
+    FileInfo SPDB_SDKFileSystem::make_file_info(const std::string &name, const struct stat &st) const
+    {
         FileInfo info;
-        info.name = path.substr(path.find_last_of('/') + 1);
+        info.name = name;
         info.type = mode_to_file_type(st.st_mode);
         info.size = st.st_size;
         info.mode = st.st_mode;
@@ -241,9 +342,8 @@ namespace file_client
 
     FileType SPDB_SDKFileSystem::get_file_type(const std::string &path)
     {
-        std::string full_path = get_full_path(path);
         struct stat st;
-        if (spdb::sdk::file::stat(full_path.c_str(), &st) != 0)
+        if (!cached_stat(get_full_path(path), st))
         {
             return FileType::UNKNOWN;
         }
@@ -252,14 +352,22 @@ namespace file_client
 
     off_t SPDB_SDKFileSystem::get_file_size(const std::string &path)
     {
-        int fd = spdb::sdk::file::open(get_full_path(path).c_str(), O_RDONLY);
-        if (fd < 0)
+        // Only an already pooled descriptor is asked, opening one just for the size costs more than a stat
+        std::string full_path = get_full_path(path);
+        if (FdPool::Lease lease = fd_pool_.lookup(full_path))
         {
-            throw std::runtime_error("Cannot open file: " + path);
+            off_t size = spdb::sdk::file::file_size(lease.fd());
+            if (size >= 0)
+            {
+                return size;
+            }
         }
-        off_t size = spdb::sdk::file::file_size(fd);
-        spdb::sdk::file::close(fd);
-        return size;
+        struct stat st;
+        if (!cached_stat(full_path, st))
+        {
+            throw std::runtime_error("Cannot get file size: " + path);
+        }
+        return st.st_size;
     }
 
     size_t SPDB_SDKFileSystem::get_directory_size(const std::string &path, bool recursive)
@@ -268,7 +376,273 @@ namespace file_client
         {
             return get_file_size(path);
         }
-        return calculate_directory_size_recursive(path);
+        return get_directory_usage(path, 0).back().size;
+    }
+
+    std::vector<DirectoryUsage> SPDB_SDKFileSystem::get_directory_usage(const std::string &path, int max_depth,
+                                                                        size_t threads)
+    {
+        // Entries of one directory are stat'ed in batches so huge flat directories spread over workers too
+        static constexpr size_t STAT_BATCH = 64;
+
+        struct Node
+        {
+            std::string name;               ///< Entry name ("" for the walked directory)
+            std::string full_path;          ///< SDK path
+            size_t parent;                  ///< Parent node index
+            int depth;                      ///< Depth below the walked directory
+            std::atomic<uint64_t> own{0};   ///< Partial sum of files directly inside
+            uint64_t total = 0;             ///< Subtree sum, filled after the walk
+        };
+
+        std::string root_full_path = get_full_path(path);
+        if (!is_directory(path))
+        {
+            throw std::runtime_error("Not a directory: " + path);
+        }
+
+        std::mutex nodes_mutex;
+        std::deque<Node> nodes; // deque keeps node addresses stable while growing
+        nodes.emplace_back();
+        nodes[0].full_path = root_full_path;
+        nodes[0].parent = 0;
+        nodes[0].depth = 0;
+
+        WorkStealingPool pool(threads);
+
+        std::function<void(size_t)> walk_directory = [&](size_t index)
+        {
+            Node *node;
+            {
+                std::lock_guard<std::mutex> lock(nodes_mutex);
+                node = &nodes[index];
+            }
+
+            auto start = IoStats::Clock::now();
+            spdb::sdk::file::DIR *dir = spdb::sdk::file::opendir(node->full_path.c_str());
+            if (!dir)
+            {
+                return; // Unreadable directories count as empty
+            }
+            auto names = std::make_shared<std::vector<std::string>>();
+            struct spdb::sdk::file::dirent *entry;
+            while ((entry = spdb::sdk::file::readdir(dir)) != nullptr)
+            {
+                std::string name = entry->d_name;
+                if (name != "." && name != "..")
+                {
+                    names->push_back(std::move(name));
+                }
+            }
+            spdb::sdk::file::closedir(dir);
+            io_stats_.record(IoOp::OPENDIR, start);
+
+            for (size_t begin = 0; begin < names->size(); begin += STAT_BATCH)
+            {
+                size_t end = std::min(begin + STAT_BATCH, names->size());
+                pool.submit([&, node, index, names, begin, end]
+                            {
+                    uint64_t files_size = 0;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        std::string entry_path = join_path(node->full_path, (*names)[i]);
+                        struct stat st;
+                        if (timed_stat(entry_path, st) != 0)
+                        {
+                            continue;
+                        }
+                        if (S_ISDIR(st.st_mode))
+                        {
+                            size_t child;
+                            {
+                                std::lock_guard<std::mutex> lock(nodes_mutex);
+                                child = nodes.size();
+                                nodes.emplace_back();
+                                Node &child_node = nodes.back();
+                                child_node.name = (*names)[i];
+                                child_node.full_path = std::move(entry_path);
+                                child_node.parent = index;
+                                child_node.depth = node->depth + 1;
+                            }
+                            pool.submit([&walk_directory, child]
+                                        { walk_directory(child); });
+                        }
+                        else
+                        {
+                            files_size += st.st_size;
+                        }
+                    }
+                    node->own.fetch_add(files_size, std::memory_order_relaxed); });
+            }
+        };
+
+        pool.submit([&walk_directory]
+                    { walk_directory(0); });
+        pool.wait();
+
+        // Children are always created after their parent, so a reverse pass folds subtrees bottom-up
+        std::vector<std::vector<size_t>> children(nodes.size());
+        for (size_t i = nodes.size(); i-- > 0;)
+        {
+            nodes[i].total += nodes[i].own.load();
+            if (i > 0)
+            {
+                nodes[nodes[i].parent].total += nodes[i].total;
+                children[nodes[i].parent].push_back(i);
+            }
+        }
+
+        // Emit in post-order, siblings sorted by name
+        std::vector<DirectoryUsage> usage;
+        std::function<void(size_t, const std::string &)> emit = [&](size_t index, const std::string &rel)
+        {
+            const Node &node = nodes[index];
+            if (max_depth < 0 || node.depth < max_depth)
+            {
+                auto &kids = children[index];
+                std::sort(kids.begin(), kids.end(), [&](size_t a, size_t b)
+                          { return nodes[a].name < nodes[b].name; });
+                for (size_t kid : kids)
+                {
+                    emit(kid, rel.empty() ? nodes[kid].name : rel + "/" + nodes[kid].name);
+                }
+            }
+            usage.push_back({rel, node.total, node.depth});
+        };
+        emit(0, "");
+
+        return usage;
+    }
+
+    std::vector<FoundEntry> SPDB_SDKFileSystem::find(const std::string &path, const FindQuery &query, size_t threads)
+    {
+        std::string root_full_path = get_full_path(path);
+        struct stat root_st;
+        if (!cached_stat(root_full_path, root_st))
+        {
+            throw std::runtime_error("No such file or directory: " + path);
+        }
+
+        auto name_matches = [&query](const std::string &name)
+        {
+            return query.name_glob.empty() || fnmatch(query.name_glob.c_str(), name.c_str(), 0) == 0;
+        };
+        auto stat_matches = [&query, this](const struct stat &st)
+        {
+            if (query.type != FileType::UNKNOWN && mode_to_file_type(st.st_mode) != query.type)
+            {
+                return false;
+            }
+            if (query.has_size)
+            {
+                size_t size = st.st_size;
+                int compare = size < query.size ? -1 : (size > query.size ? 1 : 0);
+                return compare == query.size_compare;
+            }
+            return true;
+        };
+
+        std::mutex found_mutex;
+        std::vector<FoundEntry> found;
+
+        // A single file is tested against the predicates itself, like Dir_Walker::walk_posix
+        if (!S_ISDIR(root_st.st_mode))
+        {
+            std::string name = path.substr(path.find_last_of('/') + 1);
+            if (name_matches(name) && stat_matches(root_st))
+            {
+                found.push_back({"", true, mode_to_file_type(root_st.st_mode), static_cast<size_t>(root_st.st_size)});
+            }
+            return found;
+        }
+
+        WorkStealingPool pool(threads);
+
+        std::function<void(std::string, std::string, int)> walk_directory =
+            [&](std::string full_path, std::string rel, int depth)
+        {
+            std::vector<SdkDirEntry> entries;
+            if (!read_directory(full_path, entries))
+            {
+                return; // Unreadable directories are skipped like in walk_posix
+            }
+
+            int child_depth = depth + 1;
+            bool may_descend = query.max_depth < 0 || child_depth < query.max_depth;
+            std::vector<FoundEntry> local;
+            for (SdkDirEntry &dir_entry : entries)
+            {
+                const std::string &name = dir_entry.name;
+                bool name_ok = name_matches(name);
+                std::string entry_rel = rel.empty() ? name : rel + "/" + name;
+
+                // A type reported by readdir answers -type and whether to descend, only -size needs a stat
+                if (dir_entry.type != FileType::UNKNOWN && !(name_ok && query.has_size))
+                {
+                    if (name_ok && (query.type == FileType::UNKNOWN || query.type == dir_entry.type))
+                    {
+                        local.push_back({entry_rel, false, dir_entry.type, 0});
+                    }
+                    if (may_descend && dir_entry.type == FileType::DIRECTORY)
+                    {
+                        std::string entry_path = join_path(full_path, name);
+                        pool.submit([&walk_directory, entry_path = std::move(entry_path),
+                                     entry_rel = std::move(entry_rel), child_depth]
+                                    { walk_directory(entry_path, entry_rel, child_depth); });
+                    }
+                    continue;
+                }
+
+                // Without a type only entries that may be descended into or need a type/size check pay for a stat
+                if (!may_descend && !(name_ok && query.needs_stat()))
+                {
+                    if (name_ok)
+                    {
+                        local.push_back({std::move(entry_rel), false, FileType::UNKNOWN, 0});
+                    }
+                    continue;
+                }
+
+                std::string entry_path = join_path(full_path, name);
+                struct stat st;
+                if (timed_stat(entry_path, st) != 0)
+                {
+                    continue;
+                }
+                stat_cache_.store(entry_path, &st);
+
+                if (name_ok && stat_matches(st))
+                {
+                    local.push_back({entry_rel, true, mode_to_file_type(st.st_mode), static_cast<size_t>(st.st_size)});
+                }
+                if (may_descend && S_ISDIR(st.st_mode))
+                {
+                    pool.submit([&walk_directory, entry_path = std::move(entry_path),
+                                 entry_rel = std::move(entry_rel), child_depth]
+                                { walk_directory(entry_path, entry_rel, child_depth); });
+                }
+            }
+
+            if (!local.empty())
+            {
+                std::lock_guard<std::mutex> lock(found_mutex);
+                for (FoundEntry &e : local)
+                {
+                    found.push_back(std::move(e));
+                }
+            }
+        };
+
+        if (query.max_depth != 0)
+        {
+            pool.submit([&walk_directory, root_full_path]
+                        { walk_directory(root_full_path, "", 0); });
+            pool.wait();
+        }
+
+        std::sort(found.begin(), found.end(), [](const FoundEntry &a, const FoundEntry &b)
+                  { return a.path < b.path; });
+        return found;
     }
 
     std::string SPDB_SDKFileSystem::read_file_content(const std::string &path, size_t max_size)
@@ -279,7 +653,9 @@ namespace file_client
 
     std::string SPDB_SDKFileSystem::read_file_content_at_offset(const std::string &path, size_t offset, size_t length)
     {
-        return read_file_with_fd(path, [offset, length](int fd, const std::string &path) -> std::string
+        static constexpr size_t PARALLEL_READ_THRESHOLD = 4 * DEFAULT_CHUNK_SIZE; // Larger ranges use several preads in flight
+
+        return read_file_with_fd(path, [this, offset, length](int fd, const std::string &path) -> std::string
                                  {
             // Get file size
             off_t file_size = spdb::sdk::file::file_size(fd);
@@ -301,28 +677,450 @@ namespace file_client
             }
 
             std::string content;
-            if (bytes_to_read > 0)
+            if (bytes_to_read >= PARALLEL_READ_THRESHOLD && io_depth_ > 1)
+            {
+                content.reserve(bytes_to_read);
+                read_file_range_parallel(path, offset, bytes_to_read,
+                                         [&content](const char *data, size_t size, size_t)
+                                         {
+                                             content.append(data, size);
+                                             return true;
+                                         });
+            }
+            else if (bytes_to_read > 0)
             {
                 content.resize(bytes_to_read);
-                size_t total_read = 0;
-                while (total_read < bytes_to_read)
+                size_t total_read = pread_fully(fd, &content[0], bytes_to_read, offset, path);
+                content.resize(total_read);
+            }
+            return content; });
+    }
+
+    size_t SPDB_SDKFileSystem::read_file_chunks(const std::string &path, size_t offset, size_t length,
+                                                const ChunkCallback &callback, size_t chunk_size,
+                                                size_t readahead)
+    {
+        return read_file_with_fd(path, [&](int fd, const std::string &path) -> size_t
+                                 {
+            off_t file_size = spdb::sdk::file::file_size(fd);
+            if (file_size < 0)
+            {
+                throw std::runtime_error("Failed to get file size: " + path);
+            }
+            if (file_size == 0 && offset == 0)
+            {
+                return 0;
+            }
+            if (offset >= static_cast<size_t>(file_size))
+            {
+                throw std::runtime_error("Offset exceeds file size");
+            }
+
+            size_t end = static_cast<size_t>(file_size);
+            if (length != 0 && length < end - offset)
+            {
+                end = offset + length;
+            }
+
+            const size_t chunk = AlignedBuffer::round_up(std::max(chunk_size, AlignedBuffer::DEFAULT_ALIGNMENT),
+                                                         AlignedBuffer::DEFAULT_ALIGNMENT);
+            // The first chunk stops at a chunk boundary so every later pread is aligned
+            auto chunk_length = [&](size_t pos)
+            { return std::min(chunk - pos % chunk, end - pos); };
+
+            if (readahead == 0)
+            {
+                AlignedBuffer buffer(chunk);
+                size_t pos = offset;
+                while (pos < end)
                 {
-                    ssize_t bytes_read = spdb::sdk::file::pread(
-                        fd,
-                        &content[total_read],
-                        bytes_to_read - total_read,
-                        static_cast<off_t>(offset + total_read));
-                    if (bytes_read < 0)
+                    size_t want = chunk_length(pos);
+                    size_t filled = pread_fully(fd, buffer.data(), want, pos, path);
+                    if (filled == 0)
                     {
-                        throw std::runtime_error("pread failed for: " + path);
+                        break;
+                    }
+                    bool more = callback(buffer.data(), filled, pos);
+                    pos += filled;
+                    if (!more || filled < want)
+                    {
+                        break; // Stopped by consumer, or file shrank underneath us
                     }
-                    if (bytes_read == 0)
-                        break; // EOF
-                    total_read += bytes_read;
                 }
-                content.resize(total_read);
+                return pos - offset;
             }
-            return content; });
+
+            // Background reader keeps up to readahead chunks ahead of the consumer
+            struct Slot
+            {
+                AlignedBuffer buffer;
+                size_t filled = 0;
+                size_t offset = 0;
+            };
+            std::vector<Slot> slots(readahead + 1);
+            std::deque<size_t> free_slots;
+            std::deque<size_t> ready;
+            for (size_t i = 0; i < slots.size(); ++i)
+            {
+                slots[i].buffer = AlignedBuffer(chunk);
+                free_slots.push_back(i);
+            }
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool stop = false;
+            bool reader_done = false;
+            std::exception_ptr error;
+
+            std::thread reader([&]
+                               {
+                try
+                {
+                    size_t pos = offset;
+                    while (pos < end)
+                    {
+                        size_t index;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            cv.wait(lock, [&]
+                                    { return stop || !free_slots.empty(); });
+                            if (stop)
+                            {
+                                break;
+                            }
+                            index = free_slots.front();
+                            free_slots.pop_front();
+                        }
+                        size_t want = chunk_length(pos);
+                        size_t filled = pread_fully(fd, slots[index].buffer.data(), want, pos, path);
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            slots[index].filled = filled;
+                            slots[index].offset = pos;
+                            ready.push_back(index);
+                        }
+                        cv.notify_all();
+                        pos += filled;
+                        if (filled < want)
+                        {
+                            break;
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    error = std::current_exception();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    reader_done = true;
+                }
+                cv.notify_all(); });
+
+            auto stop_reader = [&]
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                cv.notify_all();
+                reader.join();
+            };
+
+            size_t delivered = 0;
+            try
+            {
+                for (;;)
+                {
+                    size_t index;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [&]
+                                { return !ready.empty() || reader_done; });
+                        if (ready.empty())
+                        {
+                            break;
+                        }
+                        index = ready.front();
+                        ready.pop_front();
+                    }
+                    const Slot &slot = slots[index];
+                    if (slot.filled == 0)
+                    {
+                        break;
+                    }
+                    bool more = callback(slot.buffer.data(), slot.filled, slot.offset);
+                    delivered += slot.filled;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        free_slots.push_back(index);
+                    }
+                    cv.notify_all();
+                    if (!more)
+                    {
+                        break;
+                    }
+                }
+            }
+            catch (...)
+            {
+                stop_reader();
+                throw;
+            }
+            stop_reader();
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            return delivered; });
+    }
+
+    size_t SPDB_SDKFileSystem::read_file_range_parallel(const std::string &path, size_t offset, size_t length,
+                                                        const ChunkCallback &callback, size_t request_size,
+                                                        size_t depth)
+    {
+        if (depth == 0)
+        {
+            depth = io_depth_;
+        }
+        if (depth <= 1)
+        {
+            return read_file_chunks(path, offset, length, callback, request_size);
+        }
+
+        return read_file_with_fd(path, [&](int fd, const std::string &path) -> size_t
+                                 {
+            off_t file_size = spdb::sdk::file::file_size(fd);
+            if (file_size < 0)
+            {
+                throw std::runtime_error("Failed to get file size: " + path);
+            }
+            if (file_size == 0 && offset == 0)
+            {
+                return 0;
+            }
+            if (offset >= static_cast<size_t>(file_size))
+            {
+                throw std::runtime_error("Offset exceeds file size");
+            }
+
+            size_t end = static_cast<size_t>(file_size);
+            if (length != 0 && length < end - offset)
+            {
+                end = offset + length;
+            }
+
+            // Sub-request k covers [begin(k), begin(k + 1)), all but the first start on a request boundary
+            const size_t request = AlignedBuffer::round_up(std::max(request_size, AlignedBuffer::DEFAULT_ALIGNMENT),
+                                                           AlignedBuffer::DEFAULT_ALIGNMENT);
+            const size_t first_boundary = (offset / request + 1) * request;
+            const size_t count = end <= first_boundary ? 1 : 1 + (end - first_boundary + request - 1) / request;
+            auto begin = [&](size_t k)
+            { return k == 0 ? offset : std::min(first_boundary + (k - 1) * request, end); };
+
+            // Workers may run up to window requests ahead of the consumer, slot k % window holds request k
+            const size_t workers_count = std::min(depth, count);
+            const size_t window = std::min(2 * depth, count);
+            struct Slot
+            {
+                AlignedBuffer buffer;
+                size_t filled = 0;
+                bool ready = false;
+            };
+            std::vector<Slot> slots(window);
+            for (auto &slot : slots)
+            {
+                slot.buffer = AlignedBuffer(request);
+            }
+            std::mutex mutex;
+            std::condition_variable cv;
+            size_t next_issue = 0;
+            size_t next_deliver = 0;
+            bool stop = false;
+            std::exception_ptr error;
+
+            auto worker = [&]
+            {
+                try
+                {
+                    for (;;)
+                    {
+                        size_t k;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            cv.wait(lock, [&]
+                                    { return stop || next_issue >= count || next_issue < next_deliver + window; });
+                            if (stop || next_issue >= count)
+                            {
+                                return;
+                            }
+                            k = next_issue++;
+                        }
+                        Slot &slot = slots[k % window];
+                        size_t filled = pread_fully(fd, slot.buffer.data(), begin(k + 1) - begin(k), begin(k), path);
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            slot.filled = filled;
+                            slot.ready = true;
+                        }
+                        cv.notify_all();
+                    }
+                }
+                catch (...)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+                        stop = true;
+                    }
+                    cv.notify_all();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            auto stop_workers = [&]
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                cv.notify_all();
+                for (auto &thread : workers)
+                {
+                    thread.join();
+                }
+            };
+
+            size_t delivered = 0;
+            try
+            {
+                for (size_t t = 0; t < workers_count; ++t)
+                {
+                    workers.emplace_back(worker);
+                }
+                for (size_t k = 0; k < count; ++k)
+                {
+                    Slot &slot = slots[k % window];
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [&]
+                                { return slot.ready || stop; });
+                        if (!slot.ready)
+                        {
+                            break; // A worker failed
+                        }
+                    }
+                    size_t want = begin(k + 1) - begin(k);
+                    bool more = slot.filled > 0 && callback(slot.buffer.data(), slot.filled, begin(k));
+                    delivered += slot.filled;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        slot.ready = false;
+                        next_deliver++;
+                    }
+                    cv.notify_all();
+                    if (!more || slot.filled < want)
+                    {
+                        break; // Stopped by consumer, or file shrank underneath us
+                    }
+                }
+            }
+            catch (...)
+            {
+                stop_workers();
+                throw;
+            }
+            stop_workers();
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            return delivered; });
+    }
+
+    FileChecksum SPDB_SDKFileSystem::checksum_file(const std::string &path, size_t chunk_size, size_t depth)
+    {
+        if (depth == 0)
+        {
+            depth = io_depth_;
+        }
+
+        return read_file_with_fd(path, [&](int fd, const std::string &path) -> FileChecksum
+                                 {
+            off_t file_size = spdb::sdk::file::file_size(fd);
+            if (file_size < 0)
+            {
+                throw std::runtime_error("Failed to get file size: " + path);
+            }
+
+            return checksum_chunks(static_cast<uint64_t>(file_size), chunk_size, depth, path,
+                                   [&](char *buffer, size_t length, uint64_t offset)
+                                   { return pread_fully(fd, buffer, length, offset, path); }); });
+    }
+
+    size_t SPDB_SDKFileSystem::pread_fully(int fd, char *buffer, size_t length, size_t offset,
+                                           const std::string &path) const
+    {
+        size_t filled = 0;
+        while (filled < length)
+        {
+            auto start = IoStats::Clock::now();
+            ssize_t bytes_read = spdb::sdk::file::pread(fd, buffer + filled, length - filled,
+                                                        static_cast<off_t>(offset + filled));
+            io_stats_.record(IoOp::READ, start, bytes_read > 0 ? static_cast<uint64_t>(bytes_read) : 0);
+            if (bytes_read < 0)
+            {
+                throw std::runtime_error("pread failed for: " + path);
+            }
+            if (bytes_read == 0)
+                break; // EOF
+            filled += bytes_read;
+        }
+        return filled;
+    }
+
+    void SPDB_SDKFileSystem::create_directory(const std::string &path)
+    {
+        std::string full_path = get_full_path(path);
+        if (spdb::sdk::file::mkdir(full_path.c_str(), 0755) != 0)
+        {
+            struct stat st;
+            if (timed_stat(full_path, st) != 0 || !S_ISDIR(st.st_mode))
+            {
+                throw std::runtime_error("Cannot create directory: " + path);
+            }
+        }
+        stat_cache_.invalidate(full_path);
+    }
+
+    void SPDB_SDKFileSystem::write_file(const std::string &path, size_t offset, const char *data, size_t size)
+    {
+        std::string full_path = get_full_path(path);
+        int fd = spdb::sdk::file::open(full_path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot open file for writing: " + path);
+        }
+        size_t written = 0;
+        while (written < size)
+        {
+            ssize_t n = spdb::sdk::file::pwrite(fd, data + written, size - written,
+                                                static_cast<off_t>(offset + written));
+            if (n <= 0)
+            {
+                spdb::sdk::file::close(fd);
+                throw std::runtime_error("pwrite failed for: " + path);
+            }
+            written += n;
+        }
+        spdb::sdk::file::close(fd);
+
+        // Pooled read descriptors and cached sizes would describe the old file
+        stat_cache_.invalidate(full_path);
+        fd_pool_.invalidate(full_path);
     }
 
     std::string SPDB_SDKFileSystem::resolve_path(const std::string &path) const
@@ -337,15 +1135,12 @@ namespace file_client
             return normalize_path(path); // 绝对路径
         }
 
-        // 相对路径处理
-        std::string resolved = current_path_;
-        if (resolved != "/")
-        {
-            resolved += "/";
-        }
-        resolved += path;
-
-        return normalize_path(resolved);
+        // 相对路径处理, current_path_ is already normalized so only path needs a pass
+        std::string resolved;
+        resolved.reserve(current_path_.size() + path.size() + 1);
+        resolved = current_path_;
+        append_normalized(resolved, 1, path);
+        return resolved;
     }
 
     std::string SPDB_SDKFileSystem::get_current_directory()
@@ -367,6 +1162,11 @@ namespace file_client
         if (is_directory(new_path))
         {
             current_path_ = new_path;
+            update_current_system_path();
+            // Entries outlive their usefulness once the user moves elsewhere
+            stat_cache_.clear();
+            metadata_cache_.clear();
+            fd_pool_.clear();
             return true;
         }
         return false;
@@ -376,30 +1176,91 @@ namespace file_client
 
     std::string SPDB_SDKFileSystem::get_full_path(const std::string &path) const
     {
-        std::string normalized = normalize_path(path);
+        // Both absolute and relative paths are taken relative to the root directory
+        std::string full_path;
+        full_path.reserve(root_path_.size() + path.size());
+        full_path = root_path_;
+        append_normalized(full_path, root_path_.size(), path);
+        return full_path;
+    }
 
-        if (normalized.empty())
+    std::string SPDB_SDKFileSystem::join_path(const std::string &dir, const std::string &name)
+    {
+        std::string joined;
+        joined.reserve(dir.size() + name.size() + 1);
+        joined = dir;
+        if (joined.empty() || joined.back() != '/')
         {
-            return root_path_ + current_path_.substr(1); // 移除前导 /
+            joined += '/';
         }
-
-        if (normalized[0] == '/')
+        if (is_plain_name(name))
         {
-            // Absolute path (relative to root directory)
-            return root_path_ + normalized.substr(1); // Remove leading /
+            joined += name;
+            return joined;
         }
-        else
+        // Names with separators or dot components still resolve, but never above dir
+        size_t floor = joined.size();
+        append_normalized(joined, floor, name);
+        if (joined.size() == floor && floor > 1)
         {
-            // Relative path
-            std::string base_path = current_path_;
-            if (base_path != "/")
-            {
-                base_path += "/";
-            }
-            base_path += normalized;
-            base_path = normalize_path(base_path);
-            return root_path_ + base_path.substr(1); // Remove leading /
+            joined.pop_back();
         }
+        return joined;
+    }
+
+    bool SPDB_SDKFileSystem::cached_stat(const std::string &full_path, struct stat &st) const
+    {
+        bool found = false;
+        if (stat_cache_.lookup(full_path, st, found))
+        {
+            return found;
+        }
+        found = timed_stat(full_path, st) == 0;
+        stat_cache_.store(full_path, found ? &st : nullptr);
+        return found;
+    }
+
+    int SPDB_SDKFileSystem::timed_stat(const std::string &full_path, struct stat &st) const
+    {
+        auto start = IoStats::Clock::now();
+        int ret = spdb::sdk::file::stat(full_path.c_str(), &st);
+        io_stats_.record(IoOp::STAT, start);
+        return ret;
+    }
+
+    StatCache &SPDB_SDKFileSystem::stat_cache()
+    {
+        return stat_cache_;
+    }
+
+    MetadataCache &SPDB_SDKFileSystem::metadata_cache()
+    {
+        return metadata_cache_;
+    }
+
+    FdPool &SPDB_SDKFileSystem::fd_pool()
+    {
+        return fd_pool_;
+    }
+
+    IoStats &SPDB_SDKFileSystem::io_stats()
+    {
+        return io_stats_;
+    }
+
+    void SPDB_SDKFileSystem::set_stat_concurrency(size_t concurrency)
+    {
+        stat_concurrency_ = std::max<size_t>(concurrency, 1);
+    }
+
+    void SPDB_SDKFileSystem::set_io_depth(size_t depth)
+    {
+        io_depth_ = std::max<size_t>(depth, 1);
+    }
+
+    size_t SPDB_SDKFileSystem::io_depth() const
+    {
+        return io_depth_;
     }
 
     FileType SPDB_SDKFileSystem::mode_to_file_type(mode_t mode) const
@@ -421,94 +1282,69 @@ namespace file_client
         return FileType::UNKNOWN;
     }
 
-    size_t SPDB_SDKFileSystem::calculate_directory_size_recursive(const std::string &path) const
+    std::string SPDB_SDKFileSystem::get_real_system_path() const
     {
-        size_t total_size = 0;
-        std::string full_path = get_full_path(path);
-
-        spdb::sdk::file::DIR *dir = spdb::sdk::file::opendir(full_path.c_str());
-        if (!dir)
-        {
-            return 0;
-        }
-
-        struct spdb::sdk::file::dirent *entry;
-        while ((entry = spdb::sdk::file::readdir(dir)) != nullptr)
-        {
-            if (entry->d_name == "." || entry->d_name == "..")
-            {
-                continue;
-            }
-
-            std::string file_path = full_path + "/" + entry->d_name;
-            struct stat st;
-            if (spdb::sdk::file::stat(file_path.c_str(), &st) == 0)
-            {
-                if (S_ISDIR(st.st_mode))
-                {
-                    // Recursively calculate subdirectory size
-                    total_size += calculate_directory_size_recursive(path + "/" + entry->d_name);
-                }
-                else
-                {
-                    total_size += st.st_size;
-                }
-            }
-        }
-
-        closedir(dir);
-        return total_size;
+        return current_system_path_;
     }
 
-    std::string SPDB_SDKFileSystem::get_real_system_path() const
+    void SPDB_SDKFileSystem::update_current_system_path()
     {
-        std::string current_system_path = root_path_ + current_path_.substr(1);
-        if (current_system_path.back() == '/' && current_system_path.length() > 1)
+        current_system_path_ = root_path_ + current_path_.substr(1);
+        if (current_system_path_.back() == '/' && current_system_path_.length() > 1)
         {
-            current_system_path.pop_back();
+            current_system_path_.pop_back();
         }
-        return current_system_path;
     }
 
     std::string SPDB_SDKFileSystem::normalize_path(const std::string &path) const
     {
-        if (path.empty())
-            return "/";
-
-        std::vector<std::string> components;
-        std::stringstream ss(path);
-        std::string component;
+        std::string result;
+        result.reserve(path.size() + 1);
+        result += '/';
+        append_normalized(result, 1, path);
+        return result;
+    }
 
-        // Split path
-        while (std::getline(ss, component, '/'))
+    void SPDB_SDKFileSystem::append_normalized(std::string &out, size_t floor, std::string_view path)
+    {
+        // out[0, floor) is an already normalized prefix ending in '/', components are appended in
+        // place and ".." truncates back to the previous separator, so the output string itself is
+        // the component stack and nothing is split or copied
+        size_t pos = 0;
+        while (pos < path.size())
         {
+            size_t end = path.find('/', pos);
+            if (end == std::string_view::npos)
+            {
+                end = path.size();
+            }
+            std::string_view component = path.substr(pos, end - pos);
+            pos = end + 1;
+
             if (component.empty() || component == ".")
             {
                 continue;
             }
             if (component == "..")
             {
-                if (!components.empty())
+                if (out.size() > floor)
                 {
-                    components.pop_back();
+                    size_t slash = out.rfind('/');
+                    out.resize(slash == std::string::npos || slash < floor ? floor : slash);
                 }
+                continue;
             }
-            else
+            if (out.size() > floor)
             {
-                components.push_back(component);
+                out += '/';
             }
+            out.append(component.data(), component.size());
         }
+    }
 
-        // Rebuild path
-        std::string result = "/";
-        for (size_t i = 0; i < components.size(); ++i)
-        {
-            if (i > 0)
-                result += "/";
-            result += components[i];
-        }
-
-        return result;
+    bool SPDB_SDKFileSystem::is_plain_name(std::string_view name)
+    {
+        return !name.empty() && name != "." && name != ".." && name.find('/') == std::string_view::npos;
     }
 
     bool SPDB_SDKFileSystem::is_safe_path(const std::string &path) const
@@ -527,94 +1363,117 @@ namespace file_client
 
     std::string SPDB_SDKFileSystem::get_file_metadata(const std::string &path)
     {
-        if (!exists(path))
-        {
-            throw std::runtime_error("File does not exist: " + path);
-        }
-
-        if (is_directory(path))
-        {
-            throw std::runtime_error("Path is a directory, cannot get metadata: " + path);
-        }
-
-        std::string full_path = get_full_path(path);
-
-        // 判断文件类型
+        std::shared_ptr<const FileMetadata> meta = read_file_metadata(path);
         std::string filename = path.substr(path.find_last_of('/') + 1);
-        std::string file_extension;
-        size_t dot_pos = filename.find_last_of('.');
-        if (dot_pos != std::string::npos)
-        {
-            file_extension = filename.substr(dot_pos + 1);
-            std::transform(file_extension.begin(), file_extension.end(), file_extension.begin(), ::tolower);
-        }
-
         std::ostringstream result;
 
-        // 根据文件类型判断并获取相应的元数据
-        if (file_extension == "ibd")
+        if (meta->kind == MetadataKind::IBD)
         {
-            // 获取IBD文件元数据
-            spdb::sdk::file::IbdMetaInfo *ibd_meta = spdb::sdk::file::get_ibd_meta_info(full_path.c_str());
-            if (ibd_meta == nullptr)
-            {
-                throw std::runtime_error("Failed to get IBD metadata for: " + filename);
-            }
-
             result << "IBD Metadata for: " << filename << "\n\n";
-            result << "UUID: " << ibd_meta->uuid << "\n";
-            result << "Space ID: " << ibd_meta->space_id << "\n";
-            result << "Shard Count: " << ibd_meta->shard_count << "\n";
-            result << "Block Count: " << ibd_meta->block_count << "\n";
+            result << "UUID: " << meta->uuid << "\n";
+            result << "Space ID: " << meta->space_id << "\n";
+            result << "Shard Count: " << meta->shard_count << "\n";
+            result << "Block Count: " << meta->block_count << "\n";
 
-            if (!ibd_meta->versions.empty())
+            if (!meta->versions.empty())
             {
-                result << "\nVersions (" << ibd_meta->versions.size() << "):\n";
-                for (size_t i = 0; i < ibd_meta->versions.size(); ++i)
+                result << "\nVersions (" << meta->versions.size() << "):\n";
+                for (size_t i = 0; i < meta->versions.size(); ++i)
                 {
-                    const auto &version = ibd_meta->versions[i];
+                    const auto &version = meta->versions[i];
                     result << "  Version " << (i + 1) << ":\n";
                     result << "    UUID: " << version.uuid << "\n";
                     result << "    Start LSN: " << version.start_lsn << "\n";
                     result << "    End LSN: " << version.end_lsn << "\n";
                     result << "    Space ID: " << version.space_id << "\n";
-                    result << "    Permission: "
-                           << (version.permission == spdb::sdk::file::IbdPermission::READ_ONLY ? "READ_ONLY" : "READ_WRITE")
-                           << "\n";
+                    result << "    Permission: " << (version.read_only ? "READ_ONLY" : "READ_WRITE") << "\n";
                 }
             }
-
-            delete ibd_meta; // 释放内存
         }
-        else if (filename.length() >= 8 && filename.substr(0, 8) == "#ib_redo")
+        else
         {
-            // 获取Redo日志元数据
-            spdb::sdk::file::RedoMetaInfo *redo_meta = spdb::sdk::file::get_redo_meta_info(full_path.c_str());
-            if (redo_meta == nullptr)
-            {
-                throw std::runtime_error("Failed to get Redo metadata for: " + filename);
-            }
-
             result << "Redo Log Metadata for: " << filename << "\n\n";
-            result << "Cluster ID: " << redo_meta->cluster_id << "\n";
-            result << "Cluster UUID: " << redo_meta->cluster_uuid << "\n";
-            result << "Chunk Size: " << redo_meta->redo_log_chunk_size << " bytes\n";
-            result << "Chunk Count: " << redo_meta->redo_log_chunk_count << "\n";
+            result << "Cluster ID: " << meta->cluster_id << "\n";
+            result << "Cluster UUID: " << meta->cluster_uuid << "\n";
+            result << "Chunk Size: " << meta->chunk_size << " bytes\n";
+            result << "Chunk Count: " << meta->chunk_count << "\n";
 
-            if (!redo_meta->slots.empty())
+            if (!meta->slots.empty())
             {
-                result << "\nSlots (" << redo_meta->slots.size() << "):\n";
-                for (size_t i = 0; i < redo_meta->slots.size(); ++i)
+                result << "\nSlots (" << meta->slots.size() << "):\n";
+                for (size_t i = 0; i < meta->slots.size(); ++i)
                 {
-                    const auto &slot = redo_meta->slots[i];
+                    const auto &slot = meta->slots[i];
                     result << "  Slot " << (i + 1) << ":\n";
                     result << "    ID: " << slot.id << "\n";
-                    result << "    Flag Use: " << slot.flag_use << "\n";
+                    result << "    Flag Use: " << slot.in_use << "\n";
                     result << "    File Name: " << slot.file_name << "\n";
                 }
             }
+        }
+
+        return result.str();
+    }
+
+    std::shared_ptr<const FileMetadata> SPDB_SDKFileSystem::read_file_metadata(const std::string &path)
+    {
+        std::string full_path = get_full_path(path);
+        if (std::shared_ptr<const FileMetadata> cached = metadata_cache_.lookup(full_path))
+        {
+            return cached;
+        }
+
+        // One (usually cached) stat answers both existence and type
+        struct stat st;
+        if (!cached_stat(full_path, st))
+        {
+            throw std::runtime_error("File does not exist: " + path);
+        }
+        if (S_ISDIR(st.st_mode))
+        {
+            throw std::runtime_error("Path is a directory, cannot get metadata: " + path);
+        }
 
-            delete redo_meta; // 释放内存
+        std::string filename = path.substr(path.find_last_of('/') + 1);
+        auto meta = std::make_shared<FileMetadata>();
+        meta->kind = metadata_kind(filename);
+        auto start = IoStats::Clock::now();
+        if (meta->kind == MetadataKind::IBD)
+        {
+            std::unique_ptr<spdb::sdk::file::IbdMetaInfo> ibd_meta(spdb::sdk::file::get_ibd_meta_info(full_path.c_str()));
+            io_stats_.record(IoOp::META, start);
+            if (!ibd_meta)
+            {
+                throw std::runtime_error("Failed to get IBD metadata for: " + filename);
+            }
+            meta->uuid = std::move(ibd_meta->uuid);
+            meta->space_id = ibd_meta->space_id;
+            meta->shard_count = ibd_meta->shard_count;
+            meta->block_count = ibd_meta->block_count;
+            meta->versions.reserve(ibd_meta->versions.size());
+            for (auto &version : ibd_meta->versions)
+            {
+                meta->versions.push_back({std::move(version.uuid), version.start_lsn, version.end_lsn, version.space_id,
+                                          version.permission == spdb::sdk::file::IbdPermission::READ_ONLY});
+            }
+        }
+        else if (meta->kind == MetadataKind::REDO)
+        {
+            std::unique_ptr<spdb::sdk::file::RedoMetaInfo> redo_meta(spdb::sdk::file::get_redo_meta_info(full_path.c_str()));
+            io_stats_.record(IoOp::META, start);
+            if (!redo_meta)
+            {
+                throw std::runtime_error("Failed to get Redo metadata for: " + filename);
+            }
+            meta->cluster_id = redo_meta->cluster_id;
+            meta->cluster_uuid = std::move(redo_meta->cluster_uuid);
+            meta->chunk_size = redo_meta->redo_log_chunk_size;
+            meta->chunk_count = redo_meta->redo_log_chunk_count;
+            meta->slots.reserve(redo_meta->slots.size());
+            for (auto &slot : redo_meta->slots)
+            {
+                meta->slots.push_back({slot.id, slot.flag_use, std::move(slot.file_name)});
+            }
         }
         else
         {
@@ -622,30 +1481,40 @@ namespace file_client
                                      "Supported: *.ibd files, #ib_redo* files");
         }
 
-        return result.str();
+        metadata_cache_.store(full_path, meta);
+        return meta;
     }
 
-    bool SPDB_SDKFileSystem::has_file_metadata(const std::string &path)
+    std::vector<std::string> SPDB_SDKFileSystem::get_redo_log_files(const std::string &path)
     {
-        if (!exists(path) || is_directory(path))
+        std::string full_path = get_full_path(path);
+        spdb::sdk::file::RedoMetaInfo *redo_meta = spdb::sdk::file::get_redo_meta_info(full_path.c_str());
+        if (redo_meta == nullptr)
         {
-            return false;
+            throw std::runtime_error("Failed to get Redo metadata for: " + path);
         }
 
-        std::string filename = path.substr(path.find_last_of('/') + 1);
-        std::string file_extension;
-        size_t dot_pos = filename.find_last_of('.');
-        if (dot_pos != std::string::npos)
+        std::vector<std::string> files;
+        for (const auto &slot : redo_meta->slots)
         {
-            file_extension = filename.substr(dot_pos + 1);
-            std::transform(file_extension.begin(), file_extension.end(), file_extension.begin(), ::tolower);
+            if (slot.flag_use && !slot.file_name.empty())
+            {
+                files.push_back(slot.file_name.substr(slot.file_name.find_last_of('/') + 1));
+            }
         }
+        delete redo_meta;
+        return files;
+    }
 
-        // 检查是否为支持的文件类型
-        // IBD文件：*.ibd
-        // Redolog文件：#ib_redo***
-        return file_extension == "ibd" ||
-               (filename.length() >= 8 && filename.substr(0, 8) == "#ib_redo");
+    bool SPDB_SDKFileSystem::has_file_metadata(const std::string &path)
+    {
+        // The name decides the kind, so the stat is only needed for candidates
+        if (metadata_kind(path) == MetadataKind::NONE)
+        {
+            return false;
+        }
+        struct stat st;
+        return cached_stat(get_full_path(path), st) && !S_ISDIR(st.st_mode);
     }
 
 } // namespace file_client
\ No newline at end of file
@@ -12,7 +12,15 @@
 #pragma once
 
 #include "filesystem_interface.h"
+#include "stat_cache.h"
+#include "metadata_cache.h"
+#include "fd_pool.h"
+#include "io_stats.h"
+#include "sdk_dirent.h"
+#include "work_stealing_pool.h"
 #include <functional>
+#include <memory>
+#include <string_view>
 #include <fcntl.h>
 #include <spdb-sdk/file/file_io.h>
 
@@ -34,6 +42,8 @@ namespace file_client {
 
         // Directory operations
         std::vector<FileInfo> list_directory(const std::string& path) override;
+        std::vector<FileInfo> list_directory_with_stats(const std::string& path,
+                                                        size_t max_in_flight = DEFAULT_STAT_CONCURRENCY) override;
         bool is_directory(const std::string& path) override;
         bool exists(const std::string& path) override;
 
@@ -42,14 +52,37 @@ namespace file_client {
         FileType get_file_type(const std::string& path) override;
         off_t get_file_size(const std::string& path) override;
         size_t get_directory_size(const std::string& path, bool recursive = true) override;
+        std::vector<DirectoryUsage> get_directory_usage(const std::string& path, int max_depth = 0,
+                                                        size_t threads = DEFAULT_WALK_THREADS) override;
+        std::vector<FoundEntry> find(const std::string& path, const FindQuery& query,
+                                     size_t threads = DEFAULT_WALK_THREADS) override;
 
         // File content reading
         std::string read_file_content(const std::string& path, size_t max_size = 0) override;
         std::string read_file_content_at_offset(const std::string& path, size_t offset, size_t length = 0) override;
+        size_t read_file_chunks(const std::string& path, size_t offset, size_t length,
+                                const ChunkCallback& callback,
+                                size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                                size_t readahead = 0) override;
+        size_t read_file_range_parallel(const std::string& path, size_t offset, size_t length,
+                                        const ChunkCallback& callback,
+                                        size_t request_size = DEFAULT_CHUNK_SIZE,
+                                        size_t depth = 0) override;
+        FileChecksum checksum_file(const std::string& path, size_t chunk_size = DEFAULT_CHECKSUM_CHUNK,
+                                   size_t depth = 0) override;
 
         // File metadata
         std::string get_file_metadata(const std::string& path) override;
         bool has_file_metadata(const std::string& path) override;
+        std::shared_ptr<const FileMetadata> read_file_metadata(const std::string& path) override;
+
+        // Redo log files registered as in use in the redo metadata slots (names only)
+        std::vector<std::string> get_redo_log_files(const std::string& path);
+
+        // File writing, only ops_bench uses it to lay out fixtures (the client commands never write)
+        // An existing directory is not an error; write_file creates a missing file
+        void create_directory(const std::string& path);
+        void write_file(const std::string& path, size_t offset, const char* data, size_t size);
 
         // Path processing
         std::string resolve_path(const std::string& path) const override;
@@ -62,37 +95,66 @@ namespace file_client {
         // Check if path tries to access above root directory
         bool is_trying_to_escape_root(const std::string& path) const;
 
+        // Number of concurrent stat requests used by list_directory, at most DEFAULT_STAT_CONCURRENCY (the stat pool size)
+        void set_stat_concurrency(size_t concurrency);
+
+        // Number of preads in flight used by read_file_range_parallel
+        void set_io_depth(size_t depth);
+        size_t io_depth() const;
+
+        // Join a normalized directory path and an entry name, plain names are concatenated without normalizing
+        static std::string join_path(const std::string& dir, const std::string& name);
+
+        // Stat cache control and counters
+        StatCache& stat_cache();
+
+        // Decoded SDK metadata cache control and counters
+        MetadataCache& metadata_cache();
+
+        // Open descriptor pool control and counters
+        FdPool& fd_pool();
+
+        // Latency histograms of the SDK calls made so far
+        IoStats& io_stats();
+
     private:
         std::string root_path_;       ///< Absolute root path
         std::string current_path_;    ///< Current relative path (relative to root directory)
+        std::string current_system_path_; ///< root_path_ joined with current_path_, rebuilt on cd
+        size_t stat_concurrency_ = DEFAULT_STAT_CONCURRENCY; ///< Stats in flight per listing
+        size_t io_depth_ = DEFAULT_IO_DEPTH;                 ///< Preads in flight per parallel range read
+        mutable IoStats io_stats_;     ///< SDK call latencies, declared before its users
+        mutable StatCache stat_cache_; ///< Stat results keyed by full path
+        MetadataCache metadata_cache_; ///< Decoded SDK metadata keyed by full path
+        mutable FdPool fd_pool_;       ///< Open read-only descriptors keyed by full path
+        std::unique_ptr<WorkStealingPool> stat_pool_; ///< Runs listing stats next to the calling thread
 
         // Helper methods
         std::string get_full_path(const std::string& path) const;
+        bool cached_stat(const std::string& full_path, struct stat& st) const;
+        bool read_directory(const std::string& full_path, std::vector<SdkDirEntry>& entries) const;
+        std::vector<FileInfo> list_entries(const std::string& path, size_t max_in_flight, bool stat_typed);
+        size_t pread_fully(int fd, char* buffer, size_t length, size_t offset, const std::string& path) const;
+        int timed_stat(const std::string& full_path, struct stat& st) const;
         FileType mode_to_file_type(mode_t mode) const;
-        size_t calculate_directory_size_recursive(const std::string& path) const;
+        FileInfo make_file_info(const std::string& name, const struct stat& st) const;
         std::string normalize_path(const std::string& path) const;
+        static void append_normalized(std::string& out, size_t floor, std::string_view path);
+        static bool is_plain_name(std::string_view name);
+        void update_current_system_path();
         bool is_safe_path(const std::string& path) const;
 
-        // File I/O helper with automatic resource management
+        // File I/O helper, the descriptor is leased from the pool for the duration of the call
         template<typename Func>
-        std::string read_file_with_fd(const std::string& path, Func&& read_func) const
+        auto read_file_with_fd(const std::string& path, Func&& read_func) const
+            -> decltype(read_func(0, path))
         {
-            std::string full_path = get_full_path(path);
-            int fd = spdb::sdk::file::open(full_path.c_str(), O_RDONLY);
-            if (fd < 0)
+            FdPool::Lease lease = fd_pool_.acquire(get_full_path(path));
+            if (!lease)
             {
                 throw std::runtime_error("Cannot open file: " + path);
             }
-            try
-            {
-                return read_func(fd, path);
-            }
-            catch (...)
-            {
-                spdb::sdk::file::close(fd);
-                throw;
-            }
-            spdb::sdk::file::close(fd);
+            return read_func(lease.fd(), path);
         }
     };
 } // namespace file_client
@@ -0,0 +1,137 @@
+/**
+ * @file stat_cache.cpp
+ * @brief File metadata cache implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "stat_cache.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace file_client
+{
+
+    StatCache::StatCache(std::chrono::milliseconds ttl, size_t capacity)
+        : capacity_(std::max<size_t>(capacity, 1)), ttl_(ttl)
+    {
+    }
+
+    bool StatCache::lookup(const std::string &key, struct stat &st, bool &found)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.expires <= Clock::now())
+        {
+            if (it != entries_.end())
+            {
+                erase(it);
+            }
+            counters_.misses++;
+            return false;
+        }
+        counters_.hits++;
+        found = it->second.exists;
+        if (found)
+        {
+            st = it->second.st;
+        }
+        return true;
+    }
+
+    void StatCache::store(const std::string &key, const struct stat *st)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ttl_.count() <= 0)
+        {
+            return;
+        }
+        auto now = Clock::now();
+        auto it = entries_.find(key);
+        if (it != entries_.end())
+        {
+            order_.splice(order_.end(), order_, it->second.order);
+        }
+        else
+        {
+            // Make room from the oldest end, expired entries go first and are not counted as evictions
+            while (!order_.empty())
+            {
+                auto oldest = entries_.find(order_.front());
+                bool expired = oldest->second.expires <= now;
+                if (!expired && entries_.size() < capacity_)
+                {
+                    break;
+                }
+                if (!expired)
+                {
+                    counters_.evictions++;
+                }
+                erase(oldest);
+            }
+            order_.push_back(key);
+            it = entries_.emplace(key, Entry()).first;
+            it->second.order = std::prev(order_.end());
+        }
+        Entry &entry = it->second;
+        entry.exists = st != nullptr;
+        if (st)
+        {
+            entry.st = *st;
+        }
+        entry.expires = now + ttl_;
+    }
+
+    void StatCache::invalidate(const std::string &key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end())
+        {
+            erase(it);
+        }
+        counters_.invalidations++;
+    }
+
+    void StatCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        order_.clear();
+        counters_.invalidations++;
+    }
+
+    void StatCache::set_ttl(std::chrono::milliseconds ttl)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ttl_ = ttl;
+        if (ttl_.count() <= 0)
+        {
+            entries_.clear();
+            order_.clear();
+        }
+    }
+
+    std::chrono::milliseconds StatCache::ttl() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ttl_;
+    }
+
+    StatCache::Counters StatCache::counters() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Counters result = counters_;
+        result.entries = entries_.size();
+        return result;
+    }
+
+    void StatCache::erase(EntryMap::iterator it)
+    {
+        order_.erase(it->second.order);
+        entries_.erase(it);
+    }
+
+} // namespace file_client
@@ -0,0 +1,118 @@
+/**
+ * @file stat_cache.h
+ * @brief File metadata cache with TTL
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Caches struct stat results keyed by resolved full path so repeated metadata
+ * queries on the same path within one interactive command cost one remote stat.
+ * The number of entries is bounded, so walks over large trees do not grow
+ * memory until the next cd.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <sys/stat.h>
+
+namespace file_client
+{
+
+    /**
+     * @class StatCache
+     * @brief Thread-safe TTL cache of stat results
+     *
+     * Both successful and failed lookups are cached, so a missing path is not
+     * re-checked remotely until its entry expires. Entries are kept in store
+     * order, which is expiry order while the TTL is unchanged, so a store
+     * drops expired entries from the oldest end and, at capacity, the oldest
+     * live one.
+     */
+    class StatCache
+    {
+    public:
+        /**
+         * @struct Counters
+         * @brief Cache effectiveness counters
+         */
+        struct Counters
+        {
+            uint64_t hits = 0;          ///< Lookups answered from the cache
+            uint64_t misses = 0;        ///< Lookups that required a remote stat
+            uint64_t invalidations = 0; ///< Explicit clear/invalidate calls
+            uint64_t evictions = 0;     ///< Live entries dropped due to capacity
+            size_t entries = 0;         ///< Current number of cached paths
+        };
+
+        static constexpr std::chrono::milliseconds DEFAULT_TTL{2000}; ///< Default entry lifetime
+        static constexpr size_t DEFAULT_CAPACITY = 65536;            ///< Default maximum number of cached paths
+
+        explicit StatCache(std::chrono::milliseconds ttl = DEFAULT_TTL, size_t capacity = DEFAULT_CAPACITY);
+
+        /**
+         * @brief Look up a cached stat result
+         * @param key Resolved full path
+         * @param st Receives the cached stat when the path exists
+         * @param found Set to true if the cached result says the path exists
+         * @return true on cache hit, false if the caller must stat remotely
+         */
+        bool lookup(const std::string &key, struct stat &st, bool &found);
+
+        /**
+         * @brief Store a stat result
+         * @param key Resolved full path
+         * @param st Stat result, nullptr records that the path does not exist
+         */
+        void store(const std::string &key, const struct stat *st);
+
+        /**
+         * @brief Drop a single path from the cache
+         * @param key Resolved full path
+         */
+        void invalidate(const std::string &key);
+
+        /**
+         * @brief Drop all cached entries
+         */
+        void clear();
+
+        /**
+         * @brief Set entry lifetime, 0 disables caching
+         */
+        void set_ttl(std::chrono::milliseconds ttl);
+
+        std::chrono::milliseconds ttl() const;
+
+        Counters counters() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        using OrderList = std::list<std::string>;
+
+        struct Entry
+        {
+            struct stat st;            ///< Cached stat data (valid when exists)
+            bool exists;               ///< Whether the stat call succeeded
+            Clock::time_point expires; ///< Expiry time
+            OrderList::iterator order; ///< Position in order_
+        };
+
+        using EntryMap = std::unordered_map<std::string, Entry>;
+
+        void erase(EntryMap::iterator it);
+
+        mutable std::mutex mutex_;
+        EntryMap entries_;
+        OrderList order_; ///< Keys in store order, oldest first
+        size_t capacity_;
+        std::chrono::milliseconds ttl_;
+        Counters counters_;
+    };
+
+} // namespace file_client
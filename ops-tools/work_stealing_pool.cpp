@@ -0,0 +1,152 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @brief Work-stealing task pool implementation
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ */
+
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace file_client
+{
+
+    namespace
+    {
+        thread_local const WorkStealingPool *current_pool = nullptr; ///< Pool owning this thread
+        thread_local size_t current_index = 0;                        ///< Worker index in that pool
+    }
+
+    WorkStealingPool::WorkStealingPool(size_t threads)
+    {
+        threads = std::max<size_t>(threads, 1);
+        for (size_t i = 0; i < threads; ++i)
+        {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < threads; ++i)
+        {
+            workers_.emplace_back(&WorkStealingPool::worker_loop, this, i);
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+        for (auto &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    void WorkStealingPool::submit(Task task)
+    {
+        // Spawned tasks stay on the spawning worker, external ones are spread round-robin
+        size_t index = current_pool == this ? current_index
+                                            : next_queue_.fetch_add(1) % queues_.size();
+        pending_.fetch_add(1);
+        queued_.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+        }
+        wake_cv_.notify_one();
+    }
+
+    void WorkStealingPool::wait()
+    {
+        {
+            std::unique_lock<std::mutex> lock(done_mutex_);
+            done_cv_.wait(lock, [this]
+                          { return pending_.load() == 0; });
+        }
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (error_)
+        {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    bool WorkStealingPool::try_pop(size_t index, Task &task)
+    {
+        // Own deque first, newest task
+        {
+            WorkerQueue &own = *queues_[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+        // Then steal the oldest task from a victim
+        for (size_t i = 1; i < queues_.size(); ++i)
+        {
+            WorkerQueue &victim = *queues_[(index + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued_.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingPool::worker_loop(size_t index)
+    {
+        current_pool = this;
+        current_index = index;
+
+        for (;;)
+        {
+            Task task;
+            if (!try_pop(index, task))
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                wake_cv_.wait(lock, [this]
+                              { return stop_ || queued_.load() > 0; });
+                if (stop_)
+                {
+                    return;
+                }
+                continue;
+            }
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+            }
+
+            if (pending_.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(done_mutex_);
+                done_cv_.notify_all();
+            }
+        }
+    }
+
+} // namespace file_client
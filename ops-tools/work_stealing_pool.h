@@ -0,0 +1,93 @@
+/**
+ * @file work_stealing_pool.h
+ * @brief Work-stealing task pool
+ * @author xiebaoma
+ * @date 2025-08-25
+ * @version 1.0.0
+ *
+ * Fixed-size thread pool where every worker owns a task deque. Tasks spawned
+ * from inside a worker go to that worker's deque (LIFO, keeps a subtree on one
+ * thread), idle workers steal the oldest task from other deques (FIFO, takes the
+ * largest remaining subtree). Suited to irregular recursive work like tree walks.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace file_client
+{
+
+    /**
+     * @class WorkStealingPool
+     * @brief Thread pool with per-worker deques and stealing
+     */
+    class WorkStealingPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+        /**
+         * @brief Start worker threads
+         * @param threads Number of workers, at least one is started
+         */
+        explicit WorkStealingPool(size_t threads);
+
+        /**
+         * @brief Stop and join workers, pending tasks are discarded
+         */
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+        /**
+         * @brief Queue a task
+         * @param task Task to run, may itself call submit()
+         */
+        void submit(Task task);
+
+        /**
+         * @brief Block until every submitted task, including spawned ones, has finished
+         * @throw Rethrows the first exception raised by a task
+         */
+        void wait();
+
+        size_t thread_count() const { return workers_.size(); }
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void worker_loop(size_t index);
+        bool try_pop(size_t index, Task &task);
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues_;
+        std::vector<std::thread> workers_;
+
+        std::atomic<size_t> queued_{0};  ///< Tasks sitting in deques
+        std::atomic<size_t> pending_{0}; ///< Tasks submitted but not finished
+        std::atomic<size_t> next_queue_{0};
+        bool stop_ = false;
+
+        std::mutex wake_mutex_;
+        std::condition_variable wake_cv_;
+        std::mutex done_mutex_;
+        std::condition_variable done_cv_;
+
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+    };
+
+} // namespace file_client
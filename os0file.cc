@@ -97,9 +97,20 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 #include <sys/types.h>
 #include <zlib.h>
 #include <ctime>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <new>
 #include <ostream>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /** include fd concurrent hash set */
@@ -114,6 +125,312 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #define SPDB_SDK_NS spdb::sdk::file::
 
+#ifndef _WIN32
+/** Routing of open descriptors between the SDK and local POSIX.
+
+os_file_create_func() and os_file_create_simple_no_error_handling_func()
+record the result of spdb_sdk::is_local_io(fd) here, indexed by the fd, and
+the close functions erase it again. The read/write, fsync and size paths then
+take the decision with a single relaxed load. Descriptors that are beyond the
+table or were not opened through this file fall back to
+spdb_sdk::is_local_io(). */
+static constexpr os_file_t OS_FD_ROUTE_TABLE_SIZE = 65536;
+
+/** Entry values of os_fd_route_table */
+enum os_fd_route_t : uint8_t {
+  OS_FD_ROUTE_UNKNOWN = 0,
+  OS_FD_ROUTE_LOCAL = 1,
+  OS_FD_ROUTE_SDK = 2
+};
+
+static std::atomic<uint8_t> os_fd_route_table[OS_FD_ROUTE_TABLE_SIZE];
+
+/** Remember where an fd that was just opened is routed.
+@param[in]      fd      open file descriptor */
+static inline void os_fd_route_record(os_file_t fd) {
+  if (fd >= 0 && fd < OS_FD_ROUTE_TABLE_SIZE) {
+    os_fd_route_table[fd].store(
+        spdb_sdk::is_local_io(fd) ? OS_FD_ROUTE_LOCAL : OS_FD_ROUTE_SDK,
+        std::memory_order_relaxed);
+  }
+}
+
+/** Drop the routing entry of an fd that is being closed.
+@param[in]      fd      file descriptor */
+static inline void os_fd_route_forget(os_file_t fd) {
+  if (fd >= 0 && fd < OS_FD_ROUTE_TABLE_SIZE) {
+    os_fd_route_table[fd].store(OS_FD_ROUTE_UNKNOWN, std::memory_order_relaxed);
+  }
+}
+
+/** Check whether I/O on an fd goes to the local filesystem.
+@param[in]      fd      file descriptor
+@return true if the fd is local, false if it belongs to the SDK */
+static inline bool os_fd_is_local(os_file_t fd) {
+  if (likely(fd >= 0 && fd < OS_FD_ROUTE_TABLE_SIZE)) {
+    const uint8_t route = os_fd_route_table[fd].load(std::memory_order_relaxed);
+    if (likely(route != OS_FD_ROUTE_UNKNOWN)) {
+      return (route == OS_FD_ROUTE_LOCAL);
+    }
+  }
+  return (spdb_sdk::is_local_io(fd));
+}
+
+/** Number of per-thread memoized path routing decisions */
+static constexpr size_t OS_PATH_ROUTE_CACHE_SIZE = 64;
+
+/** Check whether a path is served by the local filesystem.
+
+The routing rules live in remote0remote and only depend on the path and on
+startup configuration, so a decision never changes for a given path. Each
+thread keeps a small direct-mapped memo keyed by the path hash, which saves
+re-matching the same names in metadata-heavy work (DDL, recovery, directory
+walks) without any locking.
+@param[in]      path    file or directory path
+@return true if the path is local, false if it belongs to the SDK */
+static bool os_path_is_local(const char *path) {
+  struct Path_route {
+    size_t hash{0};
+    bool valid{false};
+    bool local{false};
+    std::string path;
+  };
+  thread_local Path_route cache[OS_PATH_ROUTE_CACHE_SIZE];
+
+  if (path == nullptr) {
+    return (spdb_sdk::is_local_io(path));
+  }
+
+  const std::string_view name(path);
+  const size_t hash = std::hash<std::string_view>{}(name);
+  Path_route &entry = cache[hash % OS_PATH_ROUTE_CACHE_SIZE];
+
+  if (entry.valid && entry.hash == hash && entry.path == name) {
+    return (entry.local);
+  }
+
+  const bool local = spdb_sdk::is_local_io(path);
+  entry.hash = hash;
+  entry.path.assign(name.data(), name.size());
+  entry.local = local;
+  entry.valid = true;
+  return (local);
+}
+#endif /* !_WIN32 */
+
+/** Linear buckets per power of two in the I/O latency histograms */
+static constexpr size_t OS_IO_LATENCY_SUB_BUCKETS = 4;
+
+/** Number of histogram buckets. Latencies are kept in microseconds, the
+last bucket also collects everything above 2^33 us. */
+static constexpr size_t OS_IO_LATENCY_N_BUCKETS =
+    33 * OS_IO_LATENCY_SUB_BUCKETS;
+
+/** Backend dimension of the I/O latency histograms */
+enum os_io_backend_t : size_t { OS_IO_LOCAL = 0, OS_IO_SDK, OS_IO_N_BACKENDS };
+
+/** Operation dimension of the I/O latency histograms */
+enum os_io_op_t : size_t { OS_IO_READ = 0, OS_IO_WRITE, OS_IO_N_OPS };
+
+/** Submission path dimension of the I/O latency histograms */
+enum os_io_path_t : size_t { OS_IO_SYNC = 0, OS_IO_AIO, OS_IO_N_PATHS };
+
+static constexpr size_t OS_IO_N_HISTOGRAMS =
+    OS_IO_N_BACKENDS * OS_IO_N_OPS * OS_IO_N_PATHS;
+
+/** Merged log-linear (HDR style) latency histogram. Values below
+OS_IO_LATENCY_SUB_BUCKETS are exact, every higher power of two is split
+into OS_IO_LATENCY_SUB_BUCKETS equal buckets. */
+struct IOLatencyHistogram {
+  uint64_t buckets[OS_IO_LATENCY_N_BUCKETS]{};
+  uint64_t count{0};
+  uint64_t sum_us{0};
+  uint64_t max_us{0};
+
+  /** @return bucket of a latency
+  @param[in]    us      latency in microseconds */
+  static size_t bucket(uint64_t us) {
+    if (us < OS_IO_LATENCY_SUB_BUCKETS) {
+      return (us);
+    }
+
+    size_t msb = 0;
+    for (uint64_t v = us; v > 1; v >>= 1) {
+      ++msb;
+    }
+
+    const size_t sub = (us >> (msb - 2)) & (OS_IO_LATENCY_SUB_BUCKETS - 1);
+
+    return (std::min((msb - 1) * OS_IO_LATENCY_SUB_BUCKETS + sub,
+                     OS_IO_LATENCY_N_BUCKETS - 1));
+  }
+
+  /** @return largest latency that falls into a bucket
+  @param[in]    index   bucket index */
+  static uint64_t bucket_upper(size_t index) {
+    if (index < OS_IO_LATENCY_SUB_BUCKETS) {
+      return (index);
+    }
+
+    const size_t msb = index / OS_IO_LATENCY_SUB_BUCKETS + 1;
+    const uint64_t sub = index % OS_IO_LATENCY_SUB_BUCKETS;
+
+    return (((OS_IO_LATENCY_SUB_BUCKETS + sub + 1) << (msb - 2)) - 1);
+  }
+
+  /** @return the latency below which the given fraction of requests fall
+  @param[in]    fraction        quantile in (0, 1] */
+  uint64_t percentile(double fraction) const {
+    const auto rank = static_cast<uint64_t>(std::ceil(fraction * count));
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < OS_IO_LATENCY_N_BUCKETS; ++i) {
+      seen += buckets[i];
+      if (seen >= rank && seen > 0) {
+        return (std::min(bucket_upper(i), max_us));
+      }
+    }
+    return (max_us);
+  }
+};
+
+/** I/O latency histograms of one thread. Only the owning thread writes,
+with relaxed load/store pairs and never a read-modify-write, so recording
+costs about as much as a plain increment. Readers merge all threads. */
+class IOLatencyThread {
+ public:
+  IOLatencyThread();
+  ~IOLatencyThread();
+
+  /** Record one request.
+  @param[in]    histogram       histogram index
+  @param[in]    us              latency in microseconds */
+  void record(size_t histogram, uint64_t us) {
+    auto &bucket = m_buckets[histogram][IOLatencyHistogram::bucket(us)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+
+    auto &sum = m_sum_us[histogram];
+    sum.store(sum.load(std::memory_order_relaxed) + us,
+              std::memory_order_relaxed);
+
+    if (us > m_max_us[histogram].load(std::memory_order_relaxed)) {
+      m_max_us[histogram].store(us, std::memory_order_relaxed);
+    }
+  }
+
+  /** Add the histograms of this thread to out.
+  @param[in,out]        out     OS_IO_N_HISTOGRAMS merged histograms */
+  void merge_into(IOLatencyHistogram *out) const {
+    for (size_t h = 0; h < OS_IO_N_HISTOGRAMS; ++h) {
+      for (size_t i = 0; i < OS_IO_LATENCY_N_BUCKETS; ++i) {
+        const uint64_t n = m_buckets[h][i].load(std::memory_order_relaxed);
+        out[h].buckets[i] += n;
+        out[h].count += n;
+      }
+      out[h].sum_us += m_sum_us[h].load(std::memory_order_relaxed);
+      out[h].max_us = std::max(out[h].max_us,
+                               m_max_us[h].load(std::memory_order_relaxed));
+    }
+  }
+
+ private:
+  std::atomic<uint64_t> m_buckets[OS_IO_N_HISTOGRAMS]
+                                 [OS_IO_LATENCY_N_BUCKETS]{};
+  std::atomic<uint64_t> m_sum_us[OS_IO_N_HISTOGRAMS]{};
+  std::atomic<uint64_t> m_max_us[OS_IO_N_HISTOGRAMS]{};
+};
+
+/** Live per-thread histograms and the totals of threads that exited */
+struct IOLatencyRegistry {
+  std::mutex mutex;
+  std::vector<const IOLatencyThread *> threads;
+  IOLatencyHistogram retired[OS_IO_N_HISTOGRAMS];
+};
+
+static IOLatencyRegistry &os_io_latency_registry() {
+  static IOLatencyRegistry registry;
+  return (registry);
+}
+
+IOLatencyThread::IOLatencyThread() {
+  auto &registry = os_io_latency_registry();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+IOLatencyThread::~IOLatencyThread() {
+  auto &registry = os_io_latency_registry();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  merge_into(registry.retired);
+  registry.threads.erase(
+      std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+/** Record the latency of a finished I/O request in the calling thread.
+@param[in]      local           true if the file is on the local filesystem
+@param[in]      read            true for reads, false for writes
+@param[in]      aio             true if the request went through an AIO array
+@param[in]      start           time the request was issued */
+static inline void os_io_latency_record(
+    bool local, bool read, bool aio,
+    std::chrono::steady_clock::time_point start) {
+  thread_local IOLatencyThread histograms;
+
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+  const size_t index =
+      ((local ? OS_IO_LOCAL : OS_IO_SDK) * OS_IO_N_OPS +
+       (read ? OS_IO_READ : OS_IO_WRITE)) *
+          OS_IO_N_PATHS +
+      (aio ? OS_IO_AIO : OS_IO_SYNC);
+
+  histograms.record(index, us > 0 ? static_cast<uint64_t>(us) : 0);
+}
+
+/** Print the merged I/O latency histograms, one line per non-empty
+backend/operation/path combination.
+@param[in,out]  file            where to print */
+static void os_io_latency_print(FILE *file) {
+  IOLatencyHistogram merged[OS_IO_N_HISTOGRAMS];
+
+  {
+    auto &registry = os_io_latency_registry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+
+    for (size_t h = 0; h < OS_IO_N_HISTOGRAMS; ++h) {
+      merged[h] = registry.retired[h];
+    }
+    for (const auto thread : registry.threads) {
+      thread->merge_into(merged);
+    }
+  }
+
+  static const char *backend_names[] = {"local", "sdk"};
+  static const char *op_names[] = {"read", "write"};
+  static const char *path_names[] = {"sync", "aio"};
+
+  for (size_t h = 0; h < OS_IO_N_HISTOGRAMS; ++h) {
+    const IOLatencyHistogram &hist = merged[h];
+
+    if (hist.count == 0) {
+      continue;
+    }
+
+    fprintf(file,
+            "\nI/O latency %s %s %s: " UINT64PF " requests, avg %.1f us,"
+            " p50 " UINT64PF " us, p99 " UINT64PF " us, p99.9 " UINT64PF
+            " us, max " UINT64PF " us",
+            backend_names[h / (OS_IO_N_OPS * OS_IO_N_PATHS)],
+            op_names[(h / OS_IO_N_PATHS) % OS_IO_N_OPS],
+            path_names[h % OS_IO_N_PATHS], hist.count,
+            static_cast<double>(hist.sum_us) / hist.count,
+            hist.percentile(0.5), hist.percentile(0.99),
+            hist.percentile(0.999), hist.max_us);
+  }
+}
+
 #ifdef UNIV_HOTBACKUP
 #include <data0type.h>
 #endif /* UNIV_HOTBACKUP */
@@ -133,6 +450,34 @@ static Blocks *block_cache;
 /** Number of blocks to allocate for sync read/writes */
 static const size_t MAX_BLOCKS = 128;
 
+/** Number of free lists the block cache is split into. Every thread takes
+blocks from and returns blocks to its home list, and only steals from the
+other lists when its own is empty, so io threads rarely touch the same
+cache line. */
+static constexpr size_t OS_BLOCK_CACHE_LISTS = 16;
+
+/** Marks the end of a block free list */
+static constexpr uint32_t OS_BLOCK_NONE = UINT32_MAX;
+
+/** Lock free LIFO of block_cache indexes. The upper 32 bits of the head
+count the changes made to the list, so a compare and swap cannot succeed
+on a head that was popped and pushed back in between (ABA). */
+struct alignas(ut::INNODB_CACHE_LINE_SIZE) Block_free_list {
+  std::atomic<uint64_t> m_head{OS_BLOCK_NONE};
+};
+
+/** Block free lists, indexed by home list number */
+static Block_free_list block_lists[OS_BLOCK_CACHE_LISTS];
+
+/** Index of the next free block in the same list, by block_cache index */
+static std::atomic<uint32_t> block_next[MAX_BLOCKS];
+
+/** Blocks taken from a list other than the thread's home list */
+static std::atomic<uint64_t> os_block_n_stolen{0};
+
+/** Blocks allocated with malloc because every cached block was in use */
+static std::atomic<uint64_t> os_block_n_fallback{0};
+
 /** Block buffer size */
 #define BUFFER_BLOCK_SIZE ((ulint)(UNIV_PAGE_SIZE * 1.3))
 
@@ -407,6 +752,9 @@ struct Slot {
   /** bytes written/read. */
   ssize_t n_bytes{0};
 
+  /** true if the request is executed by the SDK instead of the kernel */
+  bool sdk_io{false};
+
   /** length of the block to read or write */
   ulint len{0};
 #else  /* !_WIN32 && !LINUX_NATIVE_AIO */
@@ -1025,42 +1373,98 @@ byte *os_block_get_frame(const file::Block *block) noexcept {
   return (static_cast<byte *>(ut_align(block->m_ptr, os_io_ptr_align)));
 }
 
-file::Block *os_alloc_block() noexcept {
-  size_t pos;
-  Blocks &blocks = *block_cache;
-  size_t i = static_cast<size_t>(my_timer_cycles());
-  const size_t size = blocks.size();
-  ulint retry = 0;
-  file::Block *block;
+/** @return the free list of the calling thread, assigned round robin on
+first use */
+static size_t os_block_home_list() {
+  static std::atomic<size_t> next_home{0};
+  thread_local const size_t home =
+      next_home.fetch_add(1, std::memory_order_relaxed) %
+      OS_BLOCK_CACHE_LISTS;
+  return (home);
+}
 
-  DBUG_EXECUTE_IF("os_block_cache_busy", retry = MAX_BLOCKS * 3;);
+/** Take a block from a free list.
+@param[in,out]  list            free list
+@return block_cache index, or OS_BLOCK_NONE if the list is empty */
+static uint32_t os_block_list_pop(Block_free_list &list) {
+  uint64_t head = list.m_head.load(std::memory_order_acquire);
 
   for (;;) {
-    /* After go through the block cache for 3 times,
-    allocate a new temporary block. */
-    if (retry == MAX_BLOCKS * 3) {
-      byte *ptr;
+    const auto index = static_cast<uint32_t>(head);
 
-      ptr = static_cast<byte *>(ut::malloc_withkey(
-          UT_NEW_THIS_FILE_PSI_KEY, sizeof(*block) + BUFFER_BLOCK_SIZE));
+    if (index == OS_BLOCK_NONE) {
+      return (index);
+    }
 
-      block = new (ptr) file::Block();
-      block->m_ptr = static_cast<byte *>(ptr + sizeof(*block));
-      block->m_in_use = true;
+    const uint64_t next =
+        (((head >> 32) + 1) << 32) |
+        block_next[index].load(std::memory_order_relaxed);
 
-      break;
+    if (list.m_head.compare_exchange_weak(head, next,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+      return (index);
     }
+  }
+}
 
-    pos = i++ % size;
+/** Return a block to a free list.
+@param[in,out]  list            free list
+@param[in]      index           block_cache index of the block */
+static void os_block_list_push(Block_free_list &list, uint32_t index) {
+  uint64_t head = list.m_head.load(std::memory_order_relaxed);
+  uint64_t next;
 
-    if (blocks[pos].m_in_use.exchange(true) == false) {
-      block = &blocks[pos];
-      break;
+  do {
+    block_next[index].store(static_cast<uint32_t>(head),
+                            std::memory_order_relaxed);
+    next = (((head >> 32) + 1) << 32) | index;
+  } while (!list.m_head.compare_exchange_weak(head, next,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+}
+
+file::Block *os_alloc_block() noexcept {
+  file::Block *block = nullptr;
+  ulint retry = 0;
+
+  DBUG_EXECUTE_IF("os_block_cache_busy", retry = 3;);
+
+  /* Try the home list first, then steal from the others. Go through all
+  lists up to 3 times before allocating a new temporary block. */
+  const size_t home = os_block_home_list();
+
+  for (; block == nullptr && retry < 3; ++retry) {
+    if (retry > 0) {
+      std::this_thread::yield();
     }
 
-    std::this_thread::yield();
+    for (size_t i = 0; i < OS_BLOCK_CACHE_LISTS; ++i) {
+      const uint32_t index =
+          os_block_list_pop(block_lists[(home + i) % OS_BLOCK_CACHE_LISTS]);
 
-    ++retry;
+      if (index != OS_BLOCK_NONE) {
+        if (i != 0) {
+          os_block_n_stolen.fetch_add(1, std::memory_order_relaxed);
+        }
+        block = &(*block_cache)[index];
+        ut_a(!block->m_in_use.exchange(true));
+        break;
+      }
+    }
+  }
+
+  if (block == nullptr) {
+    byte *ptr;
+
+    ptr = static_cast<byte *>(ut::malloc_withkey(
+        UT_NEW_THIS_FILE_PSI_KEY, sizeof(*block) + BUFFER_BLOCK_SIZE));
+
+    block = new (ptr) file::Block();
+    block->m_ptr = static_cast<byte *>(ptr + sizeof(*block));
+    block->m_in_use = true;
+
+    os_block_n_fallback.fetch_add(1, std::memory_order_relaxed);
   }
 
   ut_a(block->m_in_use);
@@ -1078,10 +1482,26 @@ void os_free_block(file::Block *block) noexcept {
   if (std::less<file::Block *>()(block, &block_cache->front()) ||
       std::greater<file::Block *>()(block, &block_cache->back())) {
     ut::free(block);
+    return;
   }
+
+  os_block_list_push(block_lists[os_block_home_list()],
+                     static_cast<uint32_t>(block - &block_cache->front()));
 }
 #ifndef UNIV_HOTBACKUP
 
+/** Print the block cache counters.
+@param[in,out]  file            where to print */
+static void os_block_cache_print(FILE *file) {
+  fprintf(file,
+          "\nBlock cache: " ULINTPF " blocks in " ULINTPF " lists, " UINT64PF
+          " stolen, " UINT64PF " fallback allocations",
+          static_cast<ulint>(block_cache != nullptr ? block_cache->size() : 0),
+          static_cast<ulint>(OS_BLOCK_CACHE_LISTS),
+          static_cast<uint64_t>(os_block_n_stolen.load()),
+          static_cast<uint64_t>(os_block_n_fallback.load()));
+}
+
 /** Generic AIO Handler methods. Currently handles IO post processing. */
 class AIOHandler {
  public:
@@ -1302,6 +1722,17 @@ dberr_t AIOHandler::post_io_processing(Slot *slot) {
     err = DB_FAIL;
   }
 
+  if (err != DB_FAIL) {
+    /* From reservation of the slot, includes the time spent queued. */
+#ifndef _WIN32
+    const bool local = os_fd_is_local(slot->file.m_file);
+#else  /* !_WIN32 */
+    const bool local = true;
+#endif /* !_WIN32 */
+    os_io_latency_record(local, slot->type.is_read(), true,
+                         slot->reservation_time);
+  }
+
   return (err);
 }
 
@@ -1508,7 +1939,7 @@ static bool os_aio_validate_skip() {
 @param[in]      name            file name
 @return 0 on success */
 static int os_file_lock(int fd, const char *name) {
-  bool on_local = spdb_sdk::is_local_io(fd);
+  bool on_local = os_fd_is_local(fd);
 
   if (likely(!on_local)) {
     /** sdk 不支持文件锁，默认返回0
@@ -2090,9 +2521,10 @@ dberr_t SyncFileIO::execute_with_retry(const IORequest &request,
 @return the number of bytes read/written or negative value on error */
 ssize_t SyncFileIO::execute(const IORequest &request) {
   ssize_t n_bytes;
+  const auto start = std::chrono::steady_clock::now();
 
   /** is meta fd and open the @parm (innodb_meta_on_local) */
-  bool is_meta = spdb_sdk::is_local_io(m_fh);
+  bool is_meta = os_fd_is_local(m_fh);
   if (likely(!is_meta)) { // more io read on user space idb
     if (request.is_read()) {
       n_bytes = SPDB_SDK_NS pread(m_fh, m_buf, m_n, m_offset);
@@ -2100,6 +2532,7 @@ ssize_t SyncFileIO::execute(const IORequest &request) {
       ut_ad(request.is_write());
       n_bytes = SPDB_SDK_NS pwrite(m_fh, m_buf, m_n, m_offset);
     }
+    os_io_latency_record(false, request.is_read(), false, start);
     return (n_bytes);
   }
 
@@ -2109,13 +2542,14 @@ ssize_t SyncFileIO::execute(const IORequest &request) {
     ut_ad(request.is_write());
     n_bytes = pwrite(m_fh, m_buf, m_n, m_offset);
   }
+  os_io_latency_record(true, request.is_read(), false, start);
 
   return (n_bytes);
 }
 
 MY_ATTRIBUTE((warn_unused_result))
 static std::string os_file_find_path_for_fd(os_file_t fd) {
-  bool on_local = spdb_sdk::is_local_io(fd);
+  bool on_local = os_fd_is_local(fd);
 
   if (!on_local)
   {
@@ -2134,6 +2568,50 @@ static std::string os_file_find_path_for_fd(os_file_t fd) {
   return std::string((err_filename != -1) ? filename : "");
 }
 
+#ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
+/** Cleared the first time the SDK reports that it cannot deallocate a range,
+so that Transparent Page Compression is disabled for SDK tablespaces without
+a failing round trip on every compressed page write. */
+static std::atomic<bool> os_sdk_punch_hole_supported{true};
+
+/** Free the storage of a section of an SDK file, the file size is unchanged.
+@param[in]      fh              SDK file handle
+@param[in]      off             Starting offset (SEEK_SET)
+@param[in]      len             Size of the hole
+@return DB_SUCCESS, DB_IO_NO_PUNCH_HOLE if the SDK or the remote storage does
+not support punching holes, or DB_IO_ERROR */
+static dberr_t os_file_sdk_punch_hole(os_file_t fh, os_offset_t off,
+                                      os_offset_t len) {
+  if (!os_sdk_punch_hole_supported.load(std::memory_order_relaxed)) {
+    return (DB_IO_NO_PUNCH_HOLE);
+  }
+
+  const int mode = FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE;
+
+  if (SPDB_SDK_NS fallocate(fh, mode, off, len) == 0) {
+    return (DB_SUCCESS);
+  }
+
+  const int err = SPDB_SDK_NS sp_errno;
+
+  if (err == EOPNOTSUPP || err == ENOSYS || err == EINVAL) {
+    if (os_sdk_punch_hole_supported.exchange(false)) {
+      ib::info(ER_IB_MSG_1359)
+          << "SPDB fallocate(punch hole) failed with errno " << err
+          << " - disabling punch hole for SPDB files.";
+    }
+    return (DB_IO_NO_PUNCH_HOLE);
+  }
+
+  ib::warn(ER_IB_MSG_754) << "SPDB fallocate(" << fh
+                          << ", FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, "
+                          << off << ", " << len
+                          << ") returned errno: " << err;
+
+  return (DB_IO_ERROR);
+}
+#endif /* HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE */
+
 /** Free storage space associated with a section of the file.
 @param[in]      fh              Open file handle
 @param[in]      off             Starting offset (SEEK_SET)
@@ -2141,10 +2619,14 @@ static std::string os_file_find_path_for_fd(os_file_t fd) {
 @return DB_SUCCESS or error code */
 static dberr_t os_file_punch_hole_posix(os_file_t fh, os_offset_t off,
                                         os_offset_t len) {
-  bool on_local = spdb_sdk::is_local_io(fh);
+  bool on_local = os_fd_is_local(fh);
 
   if (!on_local) {
+#ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
+    return (os_file_sdk_punch_hole(fh, off, len));
+#else
     return (DB_IO_NO_PUNCH_HOLE);
+#endif /* HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE */
   }
 
 #ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
@@ -2189,6 +2671,354 @@ static dberr_t os_file_punch_hole_posix(os_file_t fh, os_offset_t off,
 
 #if defined(LINUX_NATIVE_AIO)
 
+/** Number of threads that execute SDK requests for the native AIO arrays.
+SDK descriptors are not kernel descriptors and cannot be passed to
+io_submit(), so the requests are run here and completed into the slots
+the same way collect() completes kernel events. */
+static constexpr size_t OS_AIO_SDK_N_THREADS = 32;
+
+/** How long an I/O handler waits for an SDK completion before it rescans
+its segment. Kept short because the same segment may also have kernel
+requests in flight. */
+static constexpr std::chrono::microseconds OS_AIO_SDK_REAP_SLICE{200};
+
+/** io_getevents() timeout in nanoseconds while the SDK engine runs. An SDK
+request queued just after the handler went to sleep in the kernel is only
+noticed when it wakes, so the sleep is bounded well below
+OS_AIO_REAP_TIMEOUT. */
+static constexpr ulint OS_AIO_SDK_IDLE_REAP_TIMEOUT = 10000000UL;
+
+/** @return size of the largest coalesced SDK read, adjacent read-ahead pages
+are merged up to one extent and never across an extent boundary */
+static inline ulint os_aio_sdk_max_merge() {
+  return (FSP_EXTENT_SIZE * UNIV_PAGE_SIZE);
+}
+
+/** Asynchronous execution of SDK requests reserved in the native AIO
+arrays. Submitting threads only queue the slot, the completion is marked
+in the slot under the array mutex and the I/O handler of the segment
+picks it up in LinuxAIOHandler::poll(). Buffered read-ahead requests are
+held until the array is submitted and then coalesced per extent. */
+class SDKAIOEngine {
+ public:
+  /** Start the submitter threads.
+  @param[in]    n_segments      Number of global AIO segments */
+  void start(ulint n_segments) {
+    ut_a(m_threads.empty());
+
+    m_segments = std::make_unique<Segment[]>(n_segments);
+    m_n_segments = n_segments;
+    m_stop = false;
+
+    for (size_t i = 0; i < OS_AIO_SDK_N_THREADS; ++i) {
+      m_threads.emplace_back(&SDKAIOEngine::run, this);
+    }
+  }
+
+  /** @return true if the submitter threads are running */
+  bool is_started() const { return (!m_threads.empty()); }
+
+  /** Stop the submitter threads. All the slots must have been freed. */
+  void shutdown() {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      ut_a(m_queue.empty() && m_deferred.empty());
+      m_stop = true;
+    }
+    m_cv.notify_all();
+
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+    m_threads.clear();
+    m_segments.reset();
+    m_n_segments = 0;
+  }
+
+  /** Queue an SDK request. The caller must own the array mutex when the
+  slot is being resubmitted.
+  @param[in]    array           AIO array the slot belongs to
+  @param[in,out]        slot            Reserved slot
+  @param[in]    defer           Keep the request until flush_deferred()
+                                  like a buffered kernel request */
+  void submit(AIO *array, Slot *slot, bool defer) {
+    const ulint segment = AIO::get_segment_no_from_slot(array, slot);
+    ut_a(segment < m_n_segments);
+
+    if (!slot->sdk_io) {
+      slot->sdk_io = true;
+      m_segments[segment].n_reserved.fetch_add(1);
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      if (defer) {
+        ut_ad(slot->type.is_read());
+        m_deferred.push_back({array, slot, segment});
+        return;
+      }
+      m_queue.push_back(Batch{{array, slot, segment}});
+    }
+    m_cv.notify_one();
+  }
+
+  /** Hand the deferred requests to the submitter threads as one batch.
+  Reads of adjacent ranges of the same file are coalesced into a single
+  SDK request per extent. */
+  void flush_deferred() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_deferred.empty()) {
+      return;
+    }
+
+    std::sort(m_deferred.begin(), m_deferred.end(),
+              [](const Request &lhs, const Request &rhs) {
+                if (lhs.slot->file.m_file != rhs.slot->file.m_file) {
+                  return (lhs.slot->file.m_file < rhs.slot->file.m_file);
+                }
+                return (lhs.slot->offset < rhs.slot->offset);
+              });
+
+    const ulint max_merge = os_aio_sdk_max_merge();
+    Batch batch;
+
+    for (const auto &request : m_deferred) {
+      if (!batch.empty()) {
+        const Slot *first = batch.front().slot;
+        const Slot *last = batch.back().slot;
+
+        if (first->file.m_file != request.slot->file.m_file ||
+            batch.front().array != request.array ||
+            last->offset + last->len != request.slot->offset ||
+            first->offset / max_merge !=
+                (request.slot->offset + request.slot->len - 1) / max_merge) {
+          m_queue.push_back(std::move(batch));
+          batch.clear();
+        }
+      }
+      batch.push_back(request);
+    }
+    m_queue.push_back(std::move(batch));
+    m_deferred.clear();
+
+    lock.unlock();
+    m_cv.notify_all();
+  }
+
+  /** Note that the I/O handler has consumed a completed SDK slot.
+  @param[in]    global_segment  Global segment number
+  @param[in,out]        slot            Slot about to be released */
+  void consumed(ulint global_segment, Slot *slot) {
+    ut_ad(slot->sdk_io);
+    slot->sdk_io = false;
+    m_segments[global_segment].n_reserved.fetch_sub(1);
+  }
+
+  /** Check if SDK slots are reserved in the segment.
+  @param[in]    global_segment  Global segment number
+  @return true if the segment has SDK requests that are not consumed */
+  bool has_pending(ulint global_segment) const {
+    return (m_n_segments > 0 &&
+            m_segments[global_segment].n_reserved.load() > 0);
+  }
+
+  /** Read the completion counter of the segment.
+  @param[in]    global_segment  Global segment number
+  @return number of SDK requests completed on the segment so far */
+  uint64_t completions(ulint global_segment) {
+    Segment &seg = m_segments[global_segment];
+    std::lock_guard<std::mutex> guard(seg.mutex);
+    return (seg.n_completed);
+  }
+
+  /** Wait until an SDK request of the segment completes or the timeout
+  expires.
+  @param[in]    global_segment  Global segment number
+  @param[in]    seen            Value of completions() seen by the caller
+  @param[in]    timeout         Maximum time to wait */
+  void wait(ulint global_segment, uint64_t seen,
+            std::chrono::microseconds timeout) {
+    Segment &seg = m_segments[global_segment];
+    std::unique_lock<std::mutex> lock(seg.mutex);
+    seg.cv.wait_for(lock, timeout, [&] { return seg.n_completed != seen; });
+  }
+
+ private:
+  /** SDK request */
+  struct Request {
+    AIO *array;
+    Slot *slot;
+    ulint segment;
+  };
+
+  /** Requests of consecutive ranges of one file, executed as one SDK call */
+  using Batch = std::vector<Request>;
+
+  /** Completion state of a global segment */
+  struct Segment {
+    /** Reserved slots of the segment routed to the SDK */
+    std::atomic<ulint> n_reserved{0};
+
+    /** Completed requests, protected by mutex */
+    uint64_t n_completed{0};
+
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  /** Submitter thread loop */
+  void run() {
+    /* Bounce buffer for coalesced reads, reused by this thread */
+    byte *merge_buf = nullptr;
+    ulint merge_buf_size = 0;
+
+    for (;;) {
+      Batch batch;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty()) {
+          break;
+        }
+        batch = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+
+      if (batch.size() == 1) {
+        execute(batch.front());
+        continue;
+      }
+
+      const Slot *last = batch.back().slot;
+      const ulint size = last->offset + last->len - batch.front().slot->offset;
+
+      if (size > merge_buf_size) {
+        ut::aligned_free(merge_buf);
+        merge_buf =
+            static_cast<byte *>(ut::aligned_alloc(size, os_io_ptr_align));
+        merge_buf_size = merge_buf != nullptr ? size : 0;
+      }
+
+      if (merge_buf == nullptr) {
+        /* Out of memory, fall back to one SDK call per page. */
+        for (const auto &request : batch) {
+          execute(request);
+        }
+        continue;
+      }
+
+      execute_merged(batch, merge_buf);
+    }
+
+    ut::aligned_free(merge_buf);
+  }
+
+  /** Read a batch of adjacent ranges with one SDK call and scatter the data
+  into the slots.
+  @param[in]    batch           Requests sorted by offset, without holes
+  @param[in]    buf             Buffer large enough for the whole batch */
+  void execute_merged(const Batch &batch, byte *buf) {
+    Slot *first = batch.front().slot;
+    const Slot *last = batch.back().slot;
+    const ulint size = last->offset + last->len - first->offset;
+
+    const ssize_t n =
+        SPDB_SDK_NS pread(first->file.m_file, buf, size, first->offset);
+    const int sdk_errno = n < 0 ? SPDB_SDK_NS sp_errno : 0;
+
+    for (const auto &request : batch) {
+      Slot *slot = request.slot;
+      const os_offset_t pos = slot->offset - first->offset;
+
+      ssize_t n_bytes = 0;
+      if (n > 0 && static_cast<os_offset_t>(n) > pos) {
+        n_bytes = std::min<ssize_t>(n - pos, slot->len);
+        memcpy(slot->ptr, buf + pos, n_bytes);
+      }
+      complete(request, n < 0 ? -1 : n_bytes, sdk_errno);
+    }
+  }
+
+  /** Run one request on the SDK and mark its slot as done.
+  @param[in]    request         Request to execute */
+  void execute(const Request &request) {
+    Slot *slot = request.slot;
+    ssize_t n;
+
+    if (slot->type.is_read()) {
+      n = SPDB_SDK_NS pread(slot->file.m_file, slot->ptr, slot->len,
+                            slot->offset);
+    } else {
+      ut_a(slot->type.is_write());
+      n = SPDB_SDK_NS pwrite(slot->file.m_file, slot->ptr, slot->len,
+                             slot->offset);
+    }
+    const int sdk_errno = n < 0 ? SPDB_SDK_NS sp_errno : 0;
+
+    complete(request, n, sdk_errno);
+  }
+
+  /** Mark the slot of a request as done.
+  @param[in]    request         Executed request
+  @param[in]    n               Bytes transferred or -1 on error
+  @param[in]    sdk_errno       SDK error number if n is negative */
+  void complete(const Request &request, ssize_t n, int sdk_errno) {
+    Slot *slot = request.slot;
+
+    /* Keep in sync with LinuxAIOHandler::collect(). */
+    if (slot->offset > 0 && !slot->skip_punch_hole &&
+        slot->type.is_compression_enabled() && !slot->type.is_log() &&
+        slot->type.is_write() && slot->type.is_compressed() &&
+        slot->type.punch_hole() && !slot->type.is_dblwr()) {
+      slot->err = AIOHandler::io_complete(slot);
+    } else {
+      slot->err = DB_SUCCESS;
+    }
+
+    request.array->acquire();
+
+    slot->io_already_done = true;
+
+    if (n < 0) {
+      slot->n_bytes = 0;
+      slot->ret = -(sdk_errno != 0 ? sdk_errno : EIO);
+    } else {
+      slot->n_bytes = n;
+      slot->ret = 0;
+    }
+
+    request.array->release();
+
+    Segment &seg = m_segments[request.segment];
+    {
+      std::lock_guard<std::mutex> guard(seg.mutex);
+      ++seg.n_completed;
+    }
+    seg.cv.notify_all();
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+
+  /** Requests waiting for a submitter thread, protected by m_mutex */
+  std::deque<Batch> m_queue;
+
+  /** Buffered requests waiting for flush_deferred(), protected by m_mutex */
+  std::vector<Request> m_deferred;
+
+  /** Set by shutdown(), protected by m_mutex */
+  bool m_stop{false};
+
+  std::vector<std::thread> m_threads;
+
+  std::unique_ptr<Segment[]> m_segments;
+  ulint m_n_segments{0};
+};
+
+/** Executes SDK requests reserved in the native AIO arrays */
+static SDKAIOEngine sdk_aio;
+
 /** Linux native AIO handler */
 class LinuxAIOHandler {
  public:
@@ -2294,6 +3124,11 @@ dberr_t LinuxAIOHandler::resubmit(Slot *slot) {
   slot->n_bytes = 0;
   slot->io_already_done = false;
 
+  if (slot->sdk_io) {
+    sdk_aio.submit(m_array, slot, false);
+    return (DB_SUCCESS);
+  }
+
   /* make sure that slot->offset fits in off_t */
   ut_ad(sizeof(off_t) >= sizeof(os_offset_t));
   struct iocb *iocb = &slot->control;
@@ -2412,6 +3247,12 @@ void LinuxAIOHandler::collect() {
   for (;;) {
     struct io_event *events;
 
+    /* With SDK requests in flight on this segment we must not sleep in
+    io_getevents(), their completions are signalled by the SDK engine. */
+    const bool sdk_pending = sdk_aio.has_pending(m_global_segment);
+    const uint64_t sdk_seen =
+        sdk_pending ? sdk_aio.completions(m_global_segment) : 0;
+
     /* Which part of event array we are going to work on. */
     events = m_array->io_events(m_segment * m_n_slots);
 
@@ -2423,9 +3264,16 @@ void LinuxAIOHandler::collect() {
     struct timespec timeout;
 
     timeout.tv_sec = 0;
-    timeout.tv_nsec = OS_AIO_REAP_TIMEOUT;
+    if (sdk_pending) {
+      timeout.tv_nsec = 0;
+    } else if (sdk_aio.is_started()) {
+      timeout.tv_nsec = OS_AIO_SDK_IDLE_REAP_TIMEOUT;
+    } else {
+      timeout.tv_nsec = OS_AIO_REAP_TIMEOUT;
+    }
 
-    auto ret = io_getevents(io_ctx, 1, m_n_slots, events, &timeout);
+    auto ret =
+        io_getevents(io_ctx, sdk_pending ? 0 : 1, m_n_slots, events, &timeout);
 
     /* Cannot be bigger than the events array provided. */
     ut_a(ret < 0 || (ulint)ret <= m_n_slots);
@@ -2487,7 +3335,17 @@ void LinuxAIOHandler::collect() {
         slot->n_bytes = events[i].res;
         slot->ret = 0;
       }
-      m_array->release();
+      m_array->release();
+    }
+
+    if (sdk_pending) {
+      /* Let poll() rescan the segment for SDK completions. */
+      if (ret == 0) {
+        sdk_aio.wait(m_global_segment, sdk_seen, OS_AIO_SDK_REAP_SLICE);
+      }
+      if (ret >= 0) {
+        break;
+      }
     }
 
     if (srv_shutdown_state.load() == SRV_SHUTDOWN_EXIT_THREADS ||
@@ -2598,6 +3456,10 @@ dberr_t LinuxAIOHandler::poll(fil_node_t **m1, void **m2, IORequest *request) {
 
   *request = slot->type;
 
+  if (slot->sdk_io) {
+    sdk_aio.consumed(m_global_segment, slot);
+  }
+
   m_array->release(slot);
 
   m_array->release();
@@ -2662,6 +3524,8 @@ void AIO::os_aio_dispatch_read_array_submit_low_for_array(bool acquire_mutex
     return;
   }
 #if defined(LINUX_NATIVE_AIO)
+  sdk_aio.flush_deferred();
+
   const AIO *array = arr;
   ulint total_submitted = 0;
   if (acquire_mutex) array->acquire();
@@ -2730,6 +3594,12 @@ bool AIO::linux_dispatch(Slot *slot, bool should_buffer) {
   ut_a(slot->is_reserved);
   ut_ad(slot->type.validate());
 
+  if (!os_fd_is_local(slot->file.m_file)) {
+    /* SDK descriptors cannot be passed to io_submit(). */
+    sdk_aio.submit(this, slot, should_buffer);
+    return (true);
+  }
+
   /* Find out what we are going to work with.
   The iocb struct is directly in the slot.
   The io_context is one per segment. */
@@ -3033,7 +3903,7 @@ determines whether fsync or fdatasync will be used. (true -> fdatasync)
 @param[in]      file            open file handle
 @return 0 if success, -1 otherwise */
 static int os_file_fsync_posix(os_file_t file) {
-  bool on_local = spdb_sdk::is_local_io(file);
+  bool on_local = os_fd_is_local(file);
   if (likely(!on_local)) {
     return 0;
   }
@@ -3108,7 +3978,7 @@ static int os_file_fsync_posix(os_file_t file) {
 /** fsync the parent directory of a path. Useful following rename, unlink, etc..
 @param[in]      path            path of file */
 static void os_parent_dir_fsync_posix(const char *path) {
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   if (likely(!on_local)) {
     // SPDB with return empty
     return;
@@ -3157,7 +4027,7 @@ static bool os_file_status_posix_mvcc(const char *path, bool *exists,
   struct stat statinfo;
   int ret = 0, err = 0;
 
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   if (likely(!on_local)) {
     ret = SPDB_SDK_NS file_exist_rw_version(path);
   } else {
@@ -3234,7 +4104,7 @@ static bool os_file_status_posix(const char *path, bool *exists,
   struct stat statinfo;
   int ret = 0, err = 0;
 
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   if (likely(!on_local)) {
     ret = SPDB_SDK_NS stat(path, &statinfo);
   } else {
@@ -3307,7 +4177,7 @@ static bool os_file_exists_posix(const char *path) {
 
   int ret = 0, err = 0;
 
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   if (likely(!on_local)) {
     ret = SPDB_SDK_NS stat(path, &statinfo);
   } else {
@@ -3371,7 +4241,7 @@ Truncates a file at the specified position.
 @param[in]	new_len	new file length
 @return true if success */
 bool os_file_set_eof_at_func(os_file_t file, uint64_t new_len) {
-  bool on_local = spdb_sdk::is_local_io(file);
+  bool on_local = os_fd_is_local(file);
 
   if (likely(!on_local)) {
     return false;
@@ -3398,7 +4268,7 @@ but reports the error and returns false.
                                 an error.
 @return true if call succeeds, false on error */
 bool os_file_create_directory(const char *pathname, bool fail_if_exists) {
-  bool on_local = spdb_sdk::is_local_io(pathname);
+  bool on_local = os_path_is_local(pathname);
 
   int rcode = 0, err = 0;
   if (likely(!on_local)) {
@@ -3427,6 +4297,213 @@ bool os_file_create_directory(const char *pathname, bool fail_if_exists) {
   return (true);
 }
 
+/** Number of threads that list directories and stat entries while walking
+an SDK directory tree */
+static constexpr ulint OS_FILE_SDK_WALK_THREADS = 16;
+
+/** Detects whether the SDK dirent reports the entry type in d_type */
+template <typename T, typename = void>
+struct os_sdk_dirent_has_type : std::false_type {};
+
+template <typename T>
+struct os_sdk_dirent_has_type<
+    T, std::void_t<decltype(std::declval<const T &>().d_type)>>
+    : std::true_type {};
+
+/** One entry of an SDK directory listing */
+struct os_sdk_dir_entry_t {
+  /** Entry name, or the full path once the walker has joined it */
+  std::string name;
+
+  /** OS_FILE_TYPE_DIR or OS_FILE_TYPE_FILE if readdir reported the type,
+  OS_FILE_TYPE_UNKNOWN if a stat is needed to tell */
+  os_file_type_t type;
+};
+
+/** Type of an SDK directory entry as reported by readdir.
+@param[in]      dirent          directory entry
+@return OS_FILE_TYPE_UNKNOWN if the SDK does not report the type */
+template <typename Dirent>
+static os_file_type_t os_file_sdk_dirent_type(const Dirent &dirent) {
+  if constexpr (os_sdk_dirent_has_type<Dirent>::value) {
+    switch (dirent.d_type) {
+      case DT_DIR:
+        return (OS_FILE_TYPE_DIR);
+      case DT_REG:
+        return (OS_FILE_TYPE_FILE);
+      default:
+        break;
+    }
+  }
+  (void)dirent;
+  return (OS_FILE_TYPE_UNKNOWN);
+}
+
+/** Read all entries of an SDK directory, "." and ".." included. The
+directory is closed again before the entries are used, so callbacks may
+remove them.
+@param[in]      path            directory name as null-terminated string
+@param[out]     entries         entries in readdir order
+@return false if the directory could not be opened, sp_errno is set */
+static bool os_file_sdk_read_dir(const char *path,
+                                 std::vector<os_sdk_dir_entry_t> &entries) {
+  SPDB_SDK_NS DIR *directory = SPDB_SDK_NS opendir(path);
+
+  if (directory == nullptr) {
+    return (false);
+  }
+
+  for (SPDB_SDK_NS dirent *entry = SPDB_SDK_NS readdir(directory);
+       entry != nullptr; entry = SPDB_SDK_NS readdir(directory)) {
+    entries.push_back({entry->d_name.c_str(), os_file_sdk_dirent_type(*entry)});
+  }
+
+  SPDB_SDK_NS closedir(directory);
+
+  return (true);
+}
+
+/** Run fn(i) for every i in [0, n) on up to OS_FILE_SDK_WALK_THREADS
+threads, the calling thread included. The number of threads bounds the
+number of remote calls in flight.
+@param[in]      n               number of work items
+@param[in]      fn              function to call for each item */
+template <typename F>
+static void os_file_sdk_parallel_for(ulint n, F &&fn) {
+  std::atomic<ulint> next{0};
+
+  const auto run = [&]() {
+    for (ulint i = next.fetch_add(1); i < n; i = next.fetch_add(1)) {
+      fn(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  for (ulint i = 1; i < std::min(OS_FILE_SDK_WALK_THREADS, n); ++i) {
+    threads.emplace_back(run);
+  }
+
+  run();
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+/** Breadth first traversal of an SDK directory tree. Every remote opendir
+and stat is a network round trip, so all directories of one level are
+listed concurrently, and the entries whose type readdir did not report are
+then stat'ed concurrently, with OS_FILE_SDK_WALK_THREADS calls in flight.
+Entries are not stat'ed at all when readdir reports their type or when the
+scan is not recursive. f is only called from the calling thread, level by
+level, in listing order.
+@param[in]      basedir         Start scanning from this directory
+@param[in]      recursive       `true` if scan should be recursive
+@param[in]      f               Function to call for each entry */
+template <typename F>
+static void os_file_sdk_walk(const std::string &basedir, bool recursive,
+                             F &&f) {
+  struct Directory {
+    std::string path;
+    size_t depth;
+    bool opened;
+    std::vector<os_sdk_dir_entry_t> entries;
+  };
+
+  std::vector<Directory> level;
+
+  level.push_back({basedir, 0, false, {}});
+
+  while (!level.empty()) {
+    os_file_sdk_parallel_for(level.size(), [&](ulint i) {
+      level[i].opened =
+          os_file_sdk_read_dir(level[i].path.c_str(), level[i].entries);
+    });
+
+    std::vector<os_sdk_dir_entry_t *> unknown;
+
+    for (auto &dir : level) {
+      if (!dir.opened) {
+        ib::info(ER_IB_MSG_784)
+            << "Failed to walk directory"
+            << " '" << dir.path << "'";
+        continue;
+      }
+
+      /* Replace the names by full paths, dropping "." and ".." and hidden
+      entries. */
+      size_t kept = 0;
+
+      for (auto &entry : dir.entries) {
+        if (entry.name == "." || entry.name == "..") {
+          continue;
+        }
+
+        std::string path(dir.path);
+
+        if (path.back() != '/' && path.back() != '\\') {
+          path += OS_PATH_SEPARATOR;
+        }
+
+        path.append(entry.name);
+
+        /* Ignore hidden subdirectories and files. */
+        if (Fil_path::is_hidden(path)) {
+          ib::info(ER_IB_MSG_SKIP_HIDDEN_DIR, path.c_str());
+          continue;
+        }
+
+        dir.entries[kept].name = std::move(path);
+        dir.entries[kept].type = entry.type;
+        ++kept;
+      }
+
+      dir.entries.resize(kept);
+
+      if (recursive) {
+        for (auto &entry : dir.entries) {
+          if (entry.type == OS_FILE_TYPE_UNKNOWN) {
+            unknown.push_back(&entry);
+          }
+        }
+      }
+    }
+
+    os_file_sdk_parallel_for(unknown.size(), [&](ulint i) {
+      struct stat statinfo;
+
+      unknown[i]->type =
+          SPDB_SDK_NS stat(unknown[i]->name.c_str(), &statinfo) == 0 &&
+                  S_ISDIR(statinfo.st_mode)
+              ? OS_FILE_TYPE_DIR
+              : OS_FILE_TYPE_FILE;
+    });
+
+    std::vector<Directory> next;
+
+    for (auto &dir : level) {
+      if (!dir.opened) {
+        continue;
+      }
+
+      if (dir.depth == 0 && !Dir_Walker::is_directory(dir.path)) {
+        f(dir.path, dir.depth);
+      }
+
+      for (auto &entry : dir.entries) {
+        if (recursive && entry.type == OS_FILE_TYPE_DIR) {
+          next.push_back({std::move(entry.name), dir.depth + 1, false, {}});
+        } else {
+          f(entry.name, dir.depth + 1);
+        }
+      }
+    }
+
+    level = std::move(next);
+  }
+}
+
 /** This function scans the contents of a directory and invokes the callback
 for each entry.
 @param[in]      path            directory name as null-terminated string
@@ -3436,7 +4513,7 @@ for each entry.
 
 bool os_file_scan_directory(const char *path, os_dir_cbk_t scan_cbk,
                             bool is_drop) {
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   if (likely(!on_local)) {
     SPDB_SDK_NS DIR *directory = nullptr;
     SPDB_SDK_NS dirent *entry = nullptr;
@@ -3581,7 +4658,7 @@ pfs_os_file_t os_file_create_func(const char *name, ulint create_mode,
 
   bool retry;
 
-  bool on_local = spdb_sdk::is_local_io(name);
+  bool on_local = os_path_is_local(name);
   do {
 
     if (likely(!on_local)) {
@@ -3660,6 +4737,10 @@ pfs_os_file_t os_file_create_func(const char *name, ulint create_mode,
   }
 #endif /* USE_FILE_LOCK */
 
+  if (*success) {
+    os_fd_route_record(file.m_file);
+  }
+
   if (*success && (create_flag & O_CREAT) != 0) {
     os_parent_dir_fsync_posix(name);
   }
@@ -3709,7 +4790,7 @@ pfs_os_file_t os_file_create_simple_no_error_handling_func(
     return (file);
   }
 
-  bool on_local = spdb_sdk::is_local_io(name);
+  bool on_local = os_path_is_local(name);
   if (likely(!on_local)) {
     file.m_file = SPDB_SDK_NS open(name, create_flag, umask);
   } else {
@@ -3734,6 +4815,10 @@ pfs_os_file_t os_file_create_simple_no_error_handling_func(
   }
 #endif /* USE_FILE_LOCK */
 
+  if (*success) {
+    os_fd_route_record(file.m_file);
+  }
+
   if (*success && create_mode == OS_FILE_CREATE) {
     os_parent_dir_fsync_posix(name);
   }
@@ -3761,7 +4846,7 @@ bool os_file_delete_if_exists_func(const char *name, bool *exist) {
     *exist = true;
   }
 
-  bool on_local = spdb_sdk::is_local_io(name);
+  bool on_local = os_path_is_local(name);
 
   int rst = 0, err = 0;
   if (likely(!on_local)) {
@@ -3825,7 +4910,7 @@ bool os_file_rename_func(const char *oldpath, const char *newpath) {
   ut_ad(os_file_exists(oldpath));
 #endif /* UNIV_DEBUG */
 
-  bool on_local = spdb_sdk::is_local_io(oldpath);
+  bool on_local = os_path_is_local(oldpath);
   int ret = 0;
 
   if (likely(!on_local)) {
@@ -3852,7 +4937,8 @@ os_file_get_last_error.
 @param[in]      file            Handle to a file
 @return true if success */
 bool os_file_close_func(os_file_t file) {
-  bool on_local = spdb_sdk::is_local_io(file);
+  bool on_local = os_fd_is_local(file);
+  os_fd_route_forget(file);
 
   int ret = 0;
   if (likely(!on_local)) {
@@ -3881,7 +4967,7 @@ future.
 @return true if success */
 bool os_file_advise(pfs_os_file_t file, os_offset_t offset, os_offset_t len,
                     ulint advice) {
-  bool on_local = spdb_sdk::is_local_io(file.m_file);
+  bool on_local = os_fd_is_local(file.m_file);
   if (likely(!on_local)) {
     ib::info(ER_IB_MSG_749)
         << "error: SPDB not support os_file advise ";
@@ -3915,7 +5001,7 @@ bool os_file_advise(pfs_os_file_t file, os_offset_t offset, os_offset_t len,
 @param[in]      file            Handle to a file
 @return file size, or (os_offset_t) -1 on failure */
 os_offset_t os_file_get_size(pfs_os_file_t file) {
-  bool on_local = spdb_sdk::is_local_io(file.m_file);
+  bool on_local = os_fd_is_local(file.m_file);
   if (likely(!on_local)) {
       os_offset_t file_size = SPDB_SDK_NS file_size(file.m_file);
       return (file_size);
@@ -3933,7 +5019,7 @@ os_file_size_t os_file_get_size(const char *filename) {
   os_file_size_t file_size;
 
   int ret = 0;
-  bool on_local = spdb_sdk::is_local_io(filename);
+  bool on_local = os_path_is_local(filename);
   if (likely(!on_local)) {
     ret = SPDB_SDK_NS stat(filename, &s);
   } else {
@@ -3957,7 +5043,7 @@ os_file_size_t os_file_get_size(const char *filename) {
 @param[out]     free_space      free space available in bytes
 @return DB_SUCCESS if all OK */
 static dberr_t os_get_free_space_posix(const char *path, uint64_t &free_space) {
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   if (likely(!on_local)){
     ulong res = spdb::sdk::file::get_free_space();
     if (res == 0) {
@@ -3997,7 +5083,7 @@ static dberr_t os_file_get_status_posix(const char *path,
                                         os_file_stat_t *stat_info,
                                         struct stat *statinfo,
                                         bool check_rw_perm, bool read_only) {
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
   int ret = 0, err = 0;
 
   if (likely(!on_local)) {
@@ -4086,7 +5172,7 @@ size of the file.
 @return true if success */
 static bool os_file_truncate_posix(const char *pathname, pfs_os_file_t file,
                                    os_offset_t size) {
-  bool on_local = spdb_sdk::is_local_io(pathname);
+  bool on_local = os_path_is_local(pathname);
   if (likely(!on_local)) {
     ib::error(ER_IB_MSG_749)
         << "error: SPDB not support os_file_truncate_posix ";
@@ -4118,7 +5204,8 @@ bool os_file_set_eof(FILE *file) /*!< in: file to be truncated */
 @param[in]      file            Handle to a file
 @return true if success */
 bool os_file_close_no_error_handling_func(os_file_t file) {
-  bool on_local = spdb_sdk::is_local_io(file);
+  bool on_local = os_fd_is_local(file);
+  os_fd_route_forget(file);
   if (likely(!on_local)) {
     return (SPDB_SDK_NS close(file) != -1);
   }
@@ -4155,55 +5242,13 @@ void Dir_Walker::walk_posix(const Path &basedir, bool recursive, Function &&f) {
       continue;
     }
 
-    bool on_local = spdb_sdk::is_local_io(current.m_path.c_str());
+    bool on_local = os_path_is_local(current.m_path.c_str());
     if (likely(!on_local)) {
-      SPDB_SDK_NS DIR *parent = SPDB_SDK_NS opendir(current.m_path.c_str());
-
-      if (parent == nullptr) {
-        ib::info(ER_IB_MSG_784) << "Failed to walk directory"
-                                << " '" << current.m_path << "'";
-        continue;
-      }
-
-      if (!is_directory(current.m_path)) {
-        f(current.m_path, current.m_depth);
-      }
-
-      struct SPDB_SDK_NS dirent *dirent = nullptr;
-
-      for (;;) {
-        dirent = SPDB_SDK_NS readdir(parent);
-
-        if (dirent == nullptr) {
-          break;
-        }
-
-        if (strcmp(dirent->d_name.c_str(), ".") == 0 ||
-            strcmp(dirent->d_name.c_str(), "..") == 0) {
-          continue;
-        }
-
-        Path path(current.m_path);
-
-        if (path.back() != '/' && path.back() != '\\') {
-          path += OS_PATH_SEPARATOR;
-        }
-
-        path.append(dirent->d_name);
-
-        /* Ignore hidden subdirectories and files. */
-        if (Fil_path::is_hidden(path)) {
-          ib::info(ER_IB_MSG_SKIP_HIDDEN_DIR, path.c_str());
-          continue;
-        }
-
-        if (is_directory(path) && recursive) {
-          directories.push(Entry(path, current.m_depth + 1));
-        } else {
-          f(path, current.m_depth + 1);
-        }
-      }
-      SPDB_SDK_NS closedir(parent);
+      /* The SDK tree below this point is remote, walk it in parallel. */
+      os_file_sdk_walk(current.m_path, recursive,
+                       [&](const Path &path, size_t depth) {
+                         f(path, current.m_depth + depth);
+                       });
     } else {
       DIR *parent = opendir(current.m_path.c_str());
 
@@ -5885,7 +6930,7 @@ static bool os_file_handle_error_no_exit(const char *name,
 bool os_file_set_nocache(int fd [[maybe_unused]],
                          const char *file_name [[maybe_unused]],
                          const char *operation_name [[maybe_unused]]) {
-  bool on_local = spdb_sdk::is_local_io(fd);
+  bool on_local = os_fd_is_local(fd);
   if (likely(!on_local)) {
     ib::info(ER_IB_MSG_749)
         << "error: SPDB not support os_file_set_nocache";
@@ -5938,21 +6983,95 @@ bool os_file_set_nocache(int fd [[maybe_unused]],
   return true;
 }
 
+#ifdef UNIV_LINUX
+/** Cleared the first time the SDK reports that it does not implement the
+corresponding fallocate() mode, so that later extensions skip the failing
+round trip and go straight to writing zeroes. */
+#ifdef HAVE_FALLOC_FL_ZERO_RANGE
+static std::atomic<bool> os_sdk_zero_range_supported{true};
+#endif /* HAVE_FALLOC_FL_ZERO_RANGE */
+static std::atomic<bool> os_sdk_allocate_supported{true};
+
+/** Note an SDK fallocate() failure, and stop using the mode if the SDK does
+not support it.
+@param[in,out]  supported       support flag of the fallocate() mode
+@param[in]      mode_name       mode name for the message */
+static void os_file_sdk_fallocate_failed(std::atomic<bool> &supported,
+                                         const char *mode_name) {
+  const int err = SPDB_SDK_NS sp_errno;
+
+  if (err == EOPNOTSUPP || err == ENOSYS || err == EINVAL) {
+    if (supported.exchange(false)) {
+      ib::info(ER_IB_MSG_1359)
+          << "SPDB fallocate(" << mode_name << ") failed with errno " << err
+          << " - falling back to writing NULLs.";
+    }
+  }
+}
+
+/** Make a range of an SDK file read as zeroes without sending zero pages
+over the network. The range is zeroed with FALLOC_FL_ZERO_RANGE. If that
+mode is not available, a range that starts at or past the end of the file
+is preallocated with a plain fallocate(), which extends the file with
+zeroes. The caller writes the zeroes itself when this returns false.
+@param[in]      file            SDK file handle
+@param[in]      offset          start of the range
+@param[in]      len             length of the range
+@return true if the whole range now reads as zeroes */
+static bool os_file_sdk_preallocate(os_file_t file, os_offset_t offset,
+                                    os_offset_t len) {
+  if (len == 0) {
+    return (true);
+  }
+
+#ifdef HAVE_FALLOC_FL_ZERO_RANGE
+  if (os_sdk_zero_range_supported.load(std::memory_order_relaxed)) {
+    if (SPDB_SDK_NS fallocate(file, FALLOC_FL_ZERO_RANGE, offset, len) == 0) {
+      return (true);
+    }
+    os_file_sdk_fallocate_failed(os_sdk_zero_range_supported, "zero range");
+  }
+#endif /* HAVE_FALLOC_FL_ZERO_RANGE */
+
+  if (!os_sdk_allocate_supported.load(std::memory_order_relaxed)) {
+    return (false);
+  }
+
+  /* Plain allocation leaves existing data in place, use it only to extend. */
+  const os_offset_t file_size = SPDB_SDK_NS file_size(file);
+
+  if (file_size == static_cast<os_offset_t>(-1) || offset < file_size) {
+    return (false);
+  }
+
+  if (SPDB_SDK_NS fallocate(file, 0, offset, len) == 0) {
+    return (true);
+  }
+  os_file_sdk_fallocate_failed(os_sdk_allocate_supported, "allocate");
+
+  return (false);
+}
+#endif /* UNIV_LINUX */
+
 bool os_file_set_size_fast(const char *name, pfs_os_file_t pfs_file,
                            os_offset_t offset, os_offset_t size, bool flush) {
-#if defined(UNIV_LINUX) && defined(HAVE_FALLOC_FL_ZERO_RANGE)
+#ifdef UNIV_LINUX
   ut_a(size >= offset);
 
-  static bool print_message = true;
-  int ret = 0, err = 0;
-  bool on_local = spdb_sdk::is_local_io(pfs_file.m_file);
-  if (likely(!on_local)) {
-    ret =
-        SPDB_SDK_NS fallocate(pfs_file.m_file, FALLOC_FL_ZERO_RANGE, offset, size - offset);
-  } else {
-    ret =
-        fallocate(pfs_file.m_file, FALLOC_FL_ZERO_RANGE, offset, size - offset);
+  if (likely(!os_fd_is_local(pfs_file.m_file))) {
+    if (os_file_sdk_preallocate(pfs_file.m_file, offset, size - offset)) {
+      return (!flush || os_file_flush(pfs_file));
+    }
+
+    return os_file_set_size(name, pfs_file, offset, size, flush);
   }
+#endif /* UNIV_LINUX */
+
+#if defined(UNIV_LINUX) && defined(HAVE_FALLOC_FL_ZERO_RANGE)
+  static bool print_message = true;
+
+  int ret =
+      fallocate(pfs_file.m_file, FALLOC_FL_ZERO_RANGE, offset, size - offset);
 
   if (ret == 0) {
     if (flush) {
@@ -5966,13 +7085,7 @@ bool os_file_set_size_fast(const char *name, pfs_os_file_t pfs_file,
 
   /* Print the failure message only once for all the redo log files. */
   if (print_message) {
-    if (likely(!on_local)) {
-      err = spdb::sdk::file::sp_errno;
-    } else {
-      err = errno;
-    }
-
-    ib::info(ER_IB_MSG_1359) << "fallocate() failed with errno " << err
+    ib::info(ER_IB_MSG_1359) << "fallocate() failed with errno " << errno
                              << " - falling back to writing NULLs.";
     print_message = false;
   }
@@ -6112,7 +7225,7 @@ bool os_file_seek(const char *pathname, os_file_t file, os_offset_t offset) {
 #else  /* !_WIN32 */
   off_t ret;
 
-  bool on_local = spdb_sdk::is_local_io(file);
+  bool on_local = os_fd_is_local(file);
   if (likely(!on_local)) {
     ret = SPDB_SDK_NS lseek(file, offset, SEEK_SET);
   } else {
@@ -6241,6 +7354,105 @@ static dberr_t os_file_copy_read_write(os_file_t src_file,
   return (DB_SUCCESS);
 }
 
+#ifndef _WIN32
+/** Size of one request of the pipelined SDK copy */
+static constexpr ulint OS_FILE_SDK_COPY_CHUNK = 4 * 1024 * 1024;
+
+/** Number of chunks the pipelined SDK copy keeps in flight */
+static constexpr ulint OS_FILE_SDK_COPY_DEPTH = 4;
+
+/** Copy data between two files when at least one of them is on the SDK.
+The SDK has no server side copy, and sendfile() and 2 KB read/write round
+trips do not work or are too slow on remote storage. The range is split
+into large chunks instead, and several threads copy them, each through its
+own aligned buffer, so that multiple reads and writes are in flight.
+@param[in]      src_file        file handle to copy from
+@param[in]      src_offset      offset to copy from
+@param[in]      dest_file       file handle to copy to
+@param[in]      dest_offset     offset to copy to
+@param[in]      size            number of bytes to copy
+@return DB_SUCCESS if successful */
+static dberr_t os_file_copy_sdk(os_file_t src_file, os_offset_t src_offset,
+                                os_file_t dest_file, os_offset_t dest_offset,
+                                uint size) {
+  if (size == 0) {
+    return (DB_SUCCESS);
+  }
+
+  const ulint n_chunks =
+      (size + OS_FILE_SDK_COPY_CHUNK - 1) / OS_FILE_SDK_COPY_CHUNK;
+  const ulint n_threads = std::min(OS_FILE_SDK_COPY_DEPTH, n_chunks);
+  const ulint buf_size = n_chunks > 1 ? OS_FILE_SDK_COPY_CHUNK
+                                      : ut_calc_align(size, os_io_ptr_align);
+
+  auto bufs = static_cast<byte *>(
+      ut::aligned_alloc(n_threads * buf_size, os_io_ptr_align));
+
+  if (bufs == nullptr) {
+    return (os_file_copy_read_write(src_file, src_offset, dest_file,
+                                    dest_offset, size));
+  }
+
+  std::atomic<ulint> next_chunk{0};
+  std::atomic<bool> failed{false};
+
+  const auto copy = [&](byte *buf) {
+    IORequest read_request(IORequest::READ);
+    read_request.disable_compression();
+    read_request.clear_encrypted();
+
+    IORequest write_request(IORequest::WRITE);
+    write_request.disable_compression();
+    write_request.clear_encrypted();
+
+    for (;;) {
+      const ulint chunk = next_chunk.fetch_add(1);
+
+      if (chunk >= n_chunks || failed.load()) {
+        break;
+      }
+
+      const os_offset_t pos = chunk * OS_FILE_SDK_COPY_CHUNK;
+      const ulint n = std::min<ulint>(OS_FILE_SDK_COPY_CHUNK, size - pos);
+
+      SyncFileIO reader(src_file, buf, n, src_offset + pos);
+      SyncFileIO writer(dest_file, buf, n, dest_offset + pos);
+
+      if (reader.execute_with_retry(read_request, NUM_RETRIES_ON_PARTIAL_IO) !=
+              DB_SUCCESS ||
+          writer.execute_with_retry(write_request,
+                                    NUM_RETRIES_ON_PARTIAL_IO) != DB_SUCCESS) {
+        failed.store(true);
+        break;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  for (ulint i = 1; i < n_threads; ++i) {
+    threads.emplace_back(copy, bufs + i * buf_size);
+  }
+
+  copy(bufs);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ut::aligned_free(bufs);
+
+  if (failed.load()) {
+    ib::error() << "Failed to copy " << size << " bytes from offset "
+                << src_offset << " to offset " << dest_offset
+                << " on SPDB storage";
+    return (DB_IO_ERROR);
+  }
+
+  return (DB_SUCCESS);
+}
+#endif /* !_WIN32 */
+
 /** Copy data from one file to another file. Data is read/written
 at current file offset.
 @param[in]      src_file        file handle to copy from
@@ -6253,11 +7465,11 @@ at current file offset.
 dberr_t os_file_copy_func(os_file_t src_file, os_offset_t src_offset,
                           os_file_t dest_file, os_offset_t dest_offset,
                           uint size) {
-  // bool on_local = spdb_sdk::is_local_io(src_file);
-  // if (likely(!on_local)) {
-    // ib::info(ER_IB_MSG_827) << "SPDB sdk not support os_file_copy_func.";
-    // return (DB_IO_ERROR);
-  // }
+  if (!os_fd_is_local(src_file) || !os_fd_is_local(dest_file)) {
+    return (os_file_copy_sdk(src_file, src_offset, dest_file, dest_offset,
+                             size));
+  }
+
   dberr_t err;
   static bool use_sendfile = true;
 
@@ -6309,6 +7521,13 @@ dberr_t os_file_copy_func(os_file_t src_file, os_offset_t src_offset,
 dberr_t os_file_copy_func(os_file_t src_file, os_offset_t src_offset,
                           os_file_t dest_file, os_offset_t dest_offset,
                           uint size) {
+#ifndef _WIN32
+  if (!os_fd_is_local(src_file) || !os_fd_is_local(dest_file)) {
+    return (os_file_copy_sdk(src_file, src_offset, dest_file, dest_offset,
+                             size));
+  }
+#endif /* !_WIN32 */
+
   dberr_t err;
 
   err = os_file_copy_read_write(src_file, src_offset, dest_file, dest_offset,
@@ -6360,7 +7579,7 @@ bool os_file_status(const char *path, bool *exists, os_file_type_t *type) {
 #ifdef _WIN32
   return (os_file_status_win32(path, exists, type));
 #else  /* !_WIN32 */
-  if (is_source_role() && likely(!spdb_sdk::is_local_io(path))) {
+  if (is_source_role() && likely(!os_path_is_local(path))) {
     std::string_view path_view(path);
     if (path_view.size() >= 4 &&
       path_view.compare(path_view.size() - 4, 4, ".ibd") == 0) {
@@ -6398,11 +7617,6 @@ dberr_t os_file_punch_hole(os_file_t fh, os_offset_t off, os_offset_t len) {
 }
 
 bool os_is_sparse_file_supported(pfs_os_file_t fh) {
-  bool on_local = spdb_sdk::is_local_io(fh.m_file);
-  if (likely(!on_local)) {
-    return false;
-  }
-
   /* In this debugging mode, we act as if punch hole is supported,
   then we skip any calls to actually punch a hole.  In this way,
   Transparent Page Compression is still being tested. */
@@ -6411,14 +7625,15 @@ bool os_is_sparse_file_supported(pfs_os_file_t fh) {
   dberr_t err;
 
   /* We don't know the FS block size, use the sector size. The FS
-  will do the magic. */
+  will do the magic. SDK files are probed the same way, through the SDK
+  fallocate(). */
   err = os_file_punch_hole(fh.m_file, 0, UNIV_PAGE_SIZE);
 
   return (err == DB_SUCCESS);
 }
 
 dberr_t os_get_free_space(const char *path, uint64_t &free_space) {
-  bool on_local = spdb_sdk::is_local_io(path);
+  bool on_local = os_path_is_local(path);
 
   if (likely(!on_local)) {
     ib::error(ER_IB_MSG_749)
@@ -6476,6 +7691,13 @@ dberr_t os_file_write_zeros(pfs_os_file_t file, const char *name,
                             ulint page_size, os_offset_t start, ulint len) {
   ut_a(len > 0);
 
+#ifdef UNIV_LINUX
+  if (!os_fd_is_local(file.m_file) &&
+      os_file_sdk_preallocate(file.m_file, start, len)) {
+    return (DB_SUCCESS);
+  }
+#endif /* UNIV_LINUX */
+
   /* Extend at most 1M at a time */
   ulint n_bytes = std::min(static_cast<ulint>(1024 * 1024), len);
 
@@ -6506,7 +7728,7 @@ dberr_t os_file_write_zeros(pfs_os_file_t file, const char *name,
 }
 
 bool os_file_check_mode(const char *name, bool read_only) {
-  bool on_local = spdb_sdk::is_local_io(name);
+  bool on_local = os_path_is_local(name);
 
   if (likely(!on_local)) {
     return true;
@@ -6840,6 +8062,12 @@ bool AIO::start(ulint n_per_seg, ulint n_readers, ulint n_writers) {
 
   os_aio_n_segments = n_segments;
 
+#if defined(LINUX_NATIVE_AIO)
+  if (srv_use_native_aio) {
+    sdk_aio.start(n_segments);
+  }
+#endif /* LINUX_NATIVE_AIO */
+
   os_aio_validate();
 
   os_aio_segment_wait_events = static_cast<os_event_t *>(
@@ -6910,6 +8138,12 @@ void AIO::start_threads() {
 
 /** Free the AIO arrays */
 void AIO::shutdown() {
+#if defined(LINUX_NATIVE_AIO)
+  if (srv_use_native_aio) {
+    sdk_aio.shutdown();
+  }
+#endif /* LINUX_NATIVE_AIO */
+
   ut::delete_(s_ibuf);
   s_ibuf = nullptr;
 
@@ -7031,6 +8265,17 @@ void os_create_block_cache() {
 
     ut_a(it->m_ptr != nullptr);
   }
+
+  /* Spread the blocks over the free lists, the lists may still hold the
+  indexes of a previous block cache. */
+  for (auto &list : block_lists) {
+    list.m_head.store(OS_BLOCK_NONE, std::memory_order_relaxed);
+  }
+
+  for (size_t i = 0; i < block_cache->size(); ++i) {
+    os_block_list_push(block_lists[i % OS_BLOCK_CACHE_LISTS],
+                       static_cast<uint32_t>(i));
+  }
 }
 
 #ifdef UNIV_HOTBACKUP
@@ -8328,6 +9573,10 @@ void AIO::print_all(FILE *file) {
     fputs(",\n ibuf aio reads:", file);
     s_ibuf->print(file);
   }
+
+  os_io_latency_print(file);
+
+  os_block_cache_print(file);
 }
 
 /** Prints info of the aio arrays.